@@ -55,7 +55,7 @@ codeHeader = \
 
 namespace ez {
 
-    enum class FlagEffect {
+    enum class FlagEffect : uint8_t {
         NONE,
         UNSET,
         SET,
@@ -65,6 +65,25 @@ namespace ez {
         SUBTRACTION,
     };
 
+    // hot fields, looked up by the CPU on every instruction
+    struct OpCodeTiming {
+        uint8_t m_size = 0;
+        uint8_t m_cycles = 0;
+        uint8_t m_cyclesIfBranch = 0; // 0 if the instruction never branches
+    };
+
+    // cold fields, only needed for logging and the debugger
+    struct OpCodeDetails {
+        const char* m_mnemonic = "";
+        const char* m_operandName1 = "";
+        const char* m_operandName2 = "";
+        FlagEffect m_flagZero = FlagEffect::NONE;
+        FlagEffect m_flagSubtract = FlagEffect::NONE;
+        FlagEffect m_flagHalfCarry = FlagEffect::NONE;
+        FlagEffect m_flagCarry = FlagEffect::NONE;
+    };
+
+    // everything about an opcode, assembled from the tables above
     struct OpCodeInfo {
         bool m_prefixed = false;
         uint8_t m_addr = 0x00;
@@ -105,86 +124,101 @@ struct std::formatter<ez::OpCodeInfo> {
 
 
 
-def generate_switch_case(prefixed: bool, oc: dict) -> str:
-
-    def parseFlag(c: str):
-        if c == "-": 
-            return "FlagEffect::NONE"
-        if c == "0": 
-            return "FlagEffect::UNSET"
-        if c == "1": 
-            return "FlagEffect::SET"
-        if c == "Z": 
-            return "FlagEffect::ZERO"
-        if c == "H": 
-            return "FlagEffect::HALF_CARRY"
-        if c == "N": 
-            return "FlagEffect::SUBTRACTION"
-        if c == "C": 
-            return "FlagEffect::CARRY"
-
+def parse_flag(c: str) -> str:
+    flags = {
+        "-": "FlagEffect::NONE",
+        "0": "FlagEffect::UNSET",
+        "1": "FlagEffect::SET",
+        "Z": "FlagEffect::ZERO",
+        "H": "FlagEffect::HALF_CARRY",
+        "N": "FlagEffect::SUBTRACTION",
+        "C": "FlagEffect::CARRY",
+    }
+    if c not in flags:
         print("Invalid flag: ", c)
         assert(False)
+    return flags[c]
 
-    cyclesWo = oc["cycles"][0]
-    cyclesW = oc["cycles"][1] if len(oc["cycles"]) == 2 else "{}"
-
-    caseTemplate = \
-f"""
-        case {oc["addr"]}:
-            return {{{"true" if prefixed else "false"}, 
-                    {oc["addr"]}, 
-                    "{oc["mnemonic"]}",
-                    {oc["bytes"]},
-                    {cyclesWo},
-                    {cyclesW},
-                    {parseFlag(oc["flags"]["Z"])},
-                    {parseFlag(oc["flags"]["N"])},
-                    {parseFlag(oc["flags"]["H"])},
-                    {parseFlag(oc["flags"]["C"])},
-                    "{oc.get("operand1", "")}",
-                    "{oc.get("operand2", "")}",
-                   }};
-"""
-    return caseTemplate
+def sorted_opcodes(dict_name: str) -> list:
+    opcodes = sorted(json_dict[dict_name].values(), key=lambda oc: int(oc["addr"], 16))
+    assert(len(opcodes) == 256)
+    return opcodes
 
-def generate_switches():
-    # TODO split into header/cpp
+def make_comment(oc: dict) -> str:
+    return f"{oc['addr']} {oc['mnemonic']} {oc.get('operand1', '')} {oc.get('operand2', '')}".rstrip()
 
-    funcHeaderTemplate = \
-"""
-    inline OpCodeInfo {}(uint8_t code) {{
+def generate_timing_row(oc: dict) -> str:
+    # conditional branches list the taken count first
+    cycles = oc["cycles"][-1]
+    cyclesIfBranch = oc["cycles"][0] if len(oc["cycles"]) == 2 else 0
+    return f"        {{{oc['bytes']}, {cycles}, {cyclesIfBranch}}}, // {make_comment(oc)}\n"
 
-        switch(code){{
+def generate_details_row(oc: dict) -> str:
+    flags = ", ".join(parse_flag(oc["flags"][f]) for f in ["Z", "N", "H", "C"])
+    return (f"        {{\"{oc['mnemonic']}\", \"{oc.get('operand1', '')}\", \"{oc.get('operand2', '')}\", "
+            f"{flags}}},\n")
+
+def generate_tables():
+    tableHeader = \
+"""
+    inline constexpr std::array<{}, 256> {} = {{{{
+"""
+    tableFooter = \
+"""    }};
 """
 
-    funcFooter = \
+    code = ""
+    for dict_name, suffix in [("unprefixed", ""), ("cbprefixed", "_PREFIXED")]:
+        opcodes = sorted_opcodes(dict_name)
+        code += tableHeader.format("OpCodeTiming", "OPCODE_TIMINGS" + suffix)
+        code += "".join(generate_timing_row(oc) for oc in opcodes)
+        code += tableFooter
+        code += tableHeader.format("OpCodeDetails", "OPCODE_DETAILS" + suffix)
+        code += "".join(generate_details_row(oc) for oc in opcodes)
+        code += tableFooter
+
+    code += \
 """
-        default:
-            fail("Unknown OpCode: {}", code);
-        }
+    constexpr const OpCodeTiming& get_opcode_timing(uint8_t code) { return OPCODE_TIMINGS[code]; }
+
+    constexpr const OpCodeTiming& get_opcode_timing_prefixed(uint8_t code) {
+        return OPCODE_TIMINGS_PREFIXED[code];
     }
 
-"""
+    constexpr OpCodeInfo make_opcode_info(bool prefixed, uint8_t code, const OpCodeTiming& timing,
+                                          const OpCodeDetails& details) {
+        return {prefixed,
+                code,
+                details.m_mnemonic,
+                timing.m_size,
+                timing.m_cycles,
+                timing.m_cyclesIfBranch ? std::optional<int>{timing.m_cyclesIfBranch} : std::nullopt,
+                details.m_flagZero,
+                details.m_flagSubtract,
+                details.m_flagHalfCarry,
+                details.m_flagCarry,
+                details.m_operandName1,
+                details.m_operandName2};
+    }
 
-    code = funcHeaderTemplate.format("get_opcode_info")
-    for k, oc in json_dict["unprefixed"].items():
-        code += generate_switch_case(False, oc)
-    code += funcFooter
+    constexpr OpCodeInfo get_opcode_info(uint8_t code) {
+        return make_opcode_info(false, code, OPCODE_TIMINGS[code], OPCODE_DETAILS[code]);
+    }
 
-    code += funcHeaderTemplate.format("get_opcode_info_prefixed")
-    for k, oc in json_dict["cbprefixed"].items():
-        code += generate_switch_case(True, oc)
-    code += funcFooter
+    constexpr OpCodeInfo get_opcode_info_prefixed(uint8_t code) {
+        return make_opcode_info(
+            true, code, OPCODE_TIMINGS_PREFIXED[code], OPCODE_DETAILS_PREFIXED[code]);
+    }
 
+"""
     return code
 
 def make_enum_name(oc: dict) -> str:
     name: str = oc["mnemonic"]
     if "operand1" in oc:
-        name += f"_{oc["operand1"]}"
+        name += f"_{oc['operand1']}"
     if "operand2" in oc:
-        name += f"_{oc["operand2"]}"
+        name += f"_{oc['operand2']}"
 
     name = name.replace("(", "_").replace(")", "_")
     name = name.replace("+", "plus").replace("-", "minus")
@@ -204,7 +238,7 @@ def generate_enums() -> str:
     def make_row(oc: dict) -> str:
         name: str = make_enum_name(oc)
         
-        return f"        {name} = {oc["addr"]}, // {oc["mnemonic"]} {oc.get("operand1", "")} {oc.get("operand2", "")}\n"
+        return f"        {name} = {oc['addr']}, // {oc['mnemonic']} {oc.get('operand1', '')} {oc.get('operand2', '')}\n"
 
     code = enumHeader.format("OpCode")
     for k, oc in json_dict["unprefixed"].items():
@@ -222,7 +256,7 @@ if __name__ == "__main__":
 
     code = codeHeader
     code += generate_enums()
-    code += generate_switches()
+    code += generate_tables()
     code += codeFooter
 
     with open(path.join(this_script_path, "../src/OpCodes.h"), "w") as f:
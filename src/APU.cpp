@@ -153,14 +153,34 @@ void APU::update_osc4() {
     m_osc4.update(state);
 }
 
-void ez::APU::tick() {
-
-    m_timeSinceEmitSample += MASTER_CLOCK_PERIOD;
-    static constexpr auto samplePeriod = 22'675ns; // 44.1khz
+void APU::tick_for(int cycles) {
+    if (cycles <= 0) {
+        return;
+    }
 
     const bool apuEnabled = m_reg->m_nr52 & 0b1000'0000;
-    auto lrSample = audio::Sample{0.0f, 0.0f};
-    if (apuEnabled) {
+    if (!apuEnabled) {
+        // oscillators are frozen while the APU is off, only the sample clock keeps running
+        m_timeSinceEmitSample += cycles * MASTER_CLOCK_PERIOD;
+        emit_samples({0.0f, 0.0f});
+        return;
+    }
+
+    // the CPU syncs the APU before touching any of its registers, so the mixer settings can't
+    // change during a catch-up
+    const auto panMap = m_reg->m_nr51;
+    static constexpr int numChannels = 4;
+
+    // weird quirk: volume of 0 == 1 and volume of 7 == 8
+    const auto lVolume = clamp((m_reg->m_nr50 & 0b0111'0000) >> 4, 1, 7);
+    const auto rVolume = clamp(m_reg->m_nr50 & 0b0000'0111, 1, 7);
+
+    const auto lRatio = lerpInverse(lVolume, 0, 7);
+    const auto rRatio = lerpInverse(rVolume, 0, 7);
+
+    for (int i = 0; i < cycles; ++i) {
+        m_timeSinceEmitSample += MASTER_CLOCK_PERIOD;
+
         m_osc1.tick();
         m_osc2.tick();
         m_osc3.tick();
@@ -171,9 +191,6 @@ void ez::APU::tick() {
         const auto b3 = float(m_osc3.get_sample(m_reg->m_wavePattern)) / OSC_MAX_DIGITAL_OUTPUT;
         const auto b4 = float(m_osc4.get_sample()) / OSC_MAX_DIGITAL_OUTPUT;
 
-        static constexpr int numChannels = 4;
-        const auto panMap = m_reg->m_nr51;
-
         float leftSample =
             ((0b0001'0000 & panMap) ? b1 : 0.0f) + ((0b0010'0000 & panMap) ? b2 : 0.0f) +
             ((0b0100'0000 & panMap) ? b3 : 0.0f) + ((0b1000'0000 & panMap) ? b4 : 0.0f);
@@ -185,13 +202,6 @@ void ez::APU::tick() {
         leftSample /= numChannels;
         rightSample /= numChannels;
 
-        // weird quirk: volume of 0 == 1 and volume of 7 == 8
-        const auto lVolume = clamp((m_reg->m_nr50 & 0b0111'0000) >> 4, 1, 7);
-        const auto rVolume = clamp(m_reg->m_nr50 & 0b0000'0111, 1, 7);
-
-        const auto lRatio = lerpInverse(lVolume, 0, 7);
-        const auto rRatio = lerpInverse(rVolume, 0, 7);
-
         leftSample *= lRatio;
         rightSample *= rRatio;
 
@@ -199,9 +209,12 @@ void ez::APU::tick() {
         leftSample = m_filterL.process(leftSample);
         rightSample = m_filterR.process(rightSample);
 
-        lrSample = {leftSample, rightSample};
+        emit_samples({leftSample, rightSample});
     }
+}
 
+void APU::emit_samples(audio::Sample lrSample) {
+    static constexpr auto samplePeriod = 22'675ns; // 44.1khz
     while (m_timeSinceEmitSample > samplePeriod) {
         m_timeSinceEmitSample -= samplePeriod;
 
@@ -20,12 +20,15 @@ class APU {
     uint8_t read_addr(uint16_t addr) const;
     void write_addr(uint16_t addr, uint8_t val);
 
-    void tick();
+    // runs the oscillators and mixer for a number of T-cycles, registers must not change meanwhile
+    void tick_for(int cycles);
 
     std::span<const audio::Sample> get_samples() const { return {m_outputBuffer}; }
     void clear_buffer() { m_outputBuffer.clear(); }
 
   protected:
+    void emit_samples(audio::Sample lrSample); // push lrSample for every sample period elapsed
+
     void update_osc1();
     void update_osc2();
     void update_osc3();
@@ -11,6 +11,11 @@ struct DebugSettings {
     int m_breakOnOpCode = -1;
     int m_breakOnOpCodePrefixed = -1;
     int m_breakOnWriteAddr = -1;
+
+    bool any_enabled() const {
+        return m_breakOnPC != -1 || m_breakOnOpCode != -1 || m_breakOnOpCodePrefixed != -1 ||
+               m_breakOnWriteAddr != -1;
+    }
 };
 
 struct AppState {
@@ -1,6 +1,5 @@
 #pragma once
 #include "Base.h"
-#include "ThirdParty_SDL.h"
 
 namespace ez {
 
@@ -8,7 +7,6 @@ namespace audio {
 using Sample = std::array<float, 2>;
 
 static constexpr int SAMPLE_RATE = 44'100;
-static constexpr int FORMAT = AUDIO_F32;
 static constexpr int BUFFER_SIZE = 2048;
 static constexpr int NUM_CHANNELS = 2;
 
@@ -30,11 +28,17 @@ class LowPassFilter {
             ++m_currentSize;
         }
         m_average += v / m_capacity;
+        // a decaying average gets stuck on a denormal, which is dozens of times slower to do math on
+        if (std::abs(m_average) < MIN_AVERAGE) {
+            m_average = 0.0f;
+        }
 
         return m_average;
     }
 
   protected:
+    static constexpr float MIN_AVERAGE = 1e-20f;
+
     int m_capacity = 0;
     int m_currentSize = 0;
     float m_average = 0.0f;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Logger.h"
 #include "Platform.h"
 
 #include <array>
@@ -46,31 +47,39 @@ using namespace std::literals;
 
 using fSec = chrono::duration<float, std::ratio<1>>;
 
-enum class LogLevel {
-    INFO,
-    WARN,
-    ERROR,
-    CRITICAL
-};
-
-const char* to_string(LogLevel level);
-std::string to_string(const std::chrono::system_clock::time_point& tp);
-std::string to_string(const std::source_location& source);
-
+// Hands the message to the Logger, which formats and writes it on its own thread. format must be
+// a literal, it's only read once the call has returned. Errors wait until they've been written
 template <LogLevel level, typename... TArgs>
 struct log {
     log(std::string_view format, const TArgs&... args,
         std::source_location location = std::source_location::current()) {
-        std::cout << std::format(
-            "{} {} {} | {}\n", to_string(level), to_string(std::chrono::system_clock::now()),
-            to_string(location),
-            std::vformat(format, std::make_format_args(std::forward<const TArgs>(args)...)));
+        if constexpr (is_log_level_enabled(level)) {
+            auto& logger = Logger::get();
+            auto suppressed = 0;
+            if (level == LogLevel::CRITICAL || logger.admit(location, suppressed)) {
+                logger.push(level, location, suppressed, false, format, args...);
+                // a rate limited error storm mustn't wait on the writer for every call
+                if constexpr (level == LogLevel::CRITICAL || level == LogLevel::ERROR) {
+                    logger.flush();
+                }
+            }
+        }
+    }
+};
 
-        if constexpr (level == LogLevel::CRITICAL || level == LogLevel::ERROR) {
-            std::cout.flush();
+// INFO for output the user turned on and wants every line of, like the instruction log. It isn't
+// rate limited and waits for room in the ring rather than dropping anything
+template <typename... TArgs>
+struct log_verbose {
+    log_verbose(std::string_view format, const TArgs&... args,
+                std::source_location location = std::source_location::current()) {
+        if constexpr (is_log_level_enabled(LogLevel::INFO)) {
+            Logger::get().push(LogLevel::INFO, location, 0, true, format, args...);
         }
     }
 };
+template <typename... TArgs>
+log_verbose(std::string_view, TArgs&&...) -> log_verbose<TArgs...>;
 
 #ifdef EZ_CLANG
 
@@ -218,6 +227,7 @@ struct Vec4 {
     T y = T{0};
     T z = T{0};
     T w = T{0};
+    constexpr bool operator==(const Vec4&) const = default;
 };
 
 using float2 = Vec2<float>;
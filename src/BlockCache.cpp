@@ -0,0 +1,65 @@
+#include "BlockCache.h"
+#include "OpCodes.h"
+
+namespace ez {
+
+bool Block::ends_after(uint8_t op) {
+    switch (OpCode(op)) {
+        case OpCode::JR_i8:    [[fallthrough]];
+        case OpCode::JP_a16:   [[fallthrough]];
+        case OpCode::JP_HL:    [[fallthrough]];
+        case OpCode::CALL_a16: [[fallthrough]];
+        case OpCode::RET:      [[fallthrough]];
+        case OpCode::RETI:     [[fallthrough]];
+        case OpCode::RST_00h:  [[fallthrough]];
+        case OpCode::RST_08h:  [[fallthrough]];
+        case OpCode::RST_10h:  [[fallthrough]];
+        case OpCode::RST_18h:  [[fallthrough]];
+        case OpCode::RST_20h:  [[fallthrough]];
+        case OpCode::RST_28h:  [[fallthrough]];
+        case OpCode::RST_30h:  [[fallthrough]];
+        case OpCode::RST_38h:  [[fallthrough]];
+        case OpCode::HALT:     [[fallthrough]];
+        case OpCode::STOP_u8:  return true;
+        default:               return false;
+    }
+}
+
+Block* BlockCache::find(const uint8_t* code) {
+    const auto it = m_blocks.find(code);
+    return it == m_blocks.end() ? nullptr : &it->second;
+}
+
+Block& BlockCache::insert(const uint8_t* code, Block block, bool writable) {
+    const auto [it, inserted] = m_blocks.insert_or_assign(code, std::move(block));
+    if (inserted && writable) {
+        m_writableBlocks.push_back(code);
+    }
+    return it->second;
+}
+
+void BlockCache::invalidate(const uint8_t* begin, const uint8_t* end) {
+    std::erase_if(m_writableBlocks, [&](const uint8_t* code) {
+        // compare as integers, the pointers may point into different arrays
+        const auto addr = reinterpret_cast<uintptr_t>(code);
+        if (addr < reinterpret_cast<uintptr_t>(begin) || addr >= reinterpret_cast<uintptr_t>(end)) {
+            return false;
+        }
+        m_blocks.erase(code);
+        return true;
+    });
+}
+
+void BlockCache::clear() {
+    m_blocks.clear();
+    m_writableBlocks.clear();
+}
+
+void BlockCache::clear_jit() {
+    for (auto& [code, block] : m_blocks) {
+        block.m_runs = 0;
+        block.m_jitFn = nullptr;
+    }
+}
+
+} // namespace ez
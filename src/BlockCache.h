@@ -0,0 +1,55 @@
+#pragma once
+#include "Base.h"
+#include "Jit.h"
+#include <unordered_map>
+
+namespace ez {
+
+class Emulator;
+struct InstructionResult;
+
+// An instruction decoded ahead of time, everything the handler needs to run it
+struct DecodedInstr {
+    using Handler = InstructionResult (*)(Emulator& emu, uint32_t pcData);
+
+    Handler m_handler = nullptr;
+    uint32_t m_pcData = 0;   // opcode and up to 3 bytes following it, as read_pc_data returns
+    uint8_t m_size = 0;      // bytes to the next instruction
+    bool m_prefixed = false; // second half of a CB instruction
+};
+
+// Straight-line run of instructions. Ends after the first unconditional jump, call, return, HALT or
+// STOP, or before an instruction that would read past its 256 byte page. Conditional branches don't
+// end it, falling through just carries on
+struct Block {
+    static constexpr int MAX_INSTRS = 32;
+
+    std::vector<DecodedInstr> m_instrs; // empty if the first instruction can't be cached
+    uint16_t m_pc = 0;                  // of the first instruction
+    int m_runs = 0; // times entered at the first instruction, up to Jit::HOT_RUNS
+    Jit::BlockFn m_jitFn = nullptr; // CpuDispatch::JIT, once it's hot
+
+    static bool ends_after(uint8_t op); // unconditional jumps, calls, returns, HALT and STOP
+};
+
+// Decoded blocks keyed by the host address of their first byte rather than the PC, so the same PC
+// in two ROM banks is two blocks and switching banks needs no invalidation. Blocks decoded from
+// writable memory are tracked so writes can drop them
+class BlockCache {
+  public:
+    friend class Tester;
+
+    Block* find(const uint8_t* code);
+    Block& insert(const uint8_t* code, Block block, bool writable);
+    void invalidate(const uint8_t* begin, const uint8_t* end); // writable blocks starting in range
+    void clear();
+    void clear_jit(); // forgets every block's native code after Jit::clear, they start cold again
+
+    size_t size() const { return m_blocks.size(); }
+
+  private:
+    std::unordered_map<const uint8_t*, Block> m_blocks;
+    std::vector<const uint8_t*> m_writableBlocks;
+};
+
+} // namespace ez
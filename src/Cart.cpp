@@ -68,21 +68,24 @@ uint8_t Cart::read_addr(uint16_t addr) const {
 }
 
 const uint8_t* Cart::get_rom_ptr(uint16_t addr) const {
+    return m_data.data() + get_rom_offset(addr);
+}
+
+size_t Cart::get_rom_offset(uint16_t addr) const {
     ez_assert(is_valid_addr(addr));
     if (m_cartType == CartType::ROM_ONLY) {
-        return m_data.data() + addr;
+        return addr;
     } else if (is_mbc1_type(m_cartType)) {
         if (RAM_RANGE.containsExclusive(addr)) {
             fail("This is a ROM address!");
         } else {
             ez_assert(ROM_RANGE.containsExclusive(addr));
             if (addr <= 0x3FFF) { // bank 0
-                return m_data.data() + addr;
+                return addr;
             } else {
                 const auto bankSelect = std::max(m_mbc1State.m_romBankSelect, uint8_t(1));
-                const int bankedAddr = (addr - 0x4000) + (bankSelect * 0x4000);
                 // todo, support 2 bits from rom/ram mode
-                return m_data.data() + bankedAddr;
+                return size_t(addr - 0x4000) + size_t(bankSelect) * 0x4000;
             }
         }
     } else {
@@ -90,6 +93,26 @@ const uint8_t* Cart::get_rom_ptr(uint16_t addr) const {
     }
 }
 
+const uint8_t* Cart::get_read_ptr(uint16_t addr) const {
+    ez_assert(is_valid_addr(addr));
+    if (RAM_RANGE.containsExclusive(addr)) {
+        // disabled RAM reads as 0xFF, ROM only carts don't have any
+        const bool mapped = is_mbc1_type(m_cartType) && m_mbc1State.is_ram_enabled();
+        return mapped ? get_ram_ptr(addr) : nullptr;
+    }
+    // banks past the end of the file go through read_addr, don't even form a pointer to them
+    const auto offset = get_rom_offset(addr);
+    return offset < m_data.size() ? m_data.data() + offset : nullptr;
+}
+
+uint8_t* Cart::get_write_ptr(uint16_t addr) {
+    ez_assert(is_valid_addr(addr));
+    if (RAM_RANGE.containsExclusive(addr) && is_mbc1_type(m_cartType)) {
+        return get_ram_ptr(addr);
+    }
+    return nullptr; // ROM writes are MBC register writes
+}
+
 bool Cart::is_mbc1_type(CartType type) {
     // todo, fix this
     // but in the meantime we'll at least try to run anything
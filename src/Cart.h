@@ -57,6 +57,15 @@ class Cart {
 
     void write_addr(uint16_t addr, uint8_t val);
 
+    // direct pointers for the CPU memory map, nullptr if the access has to go through
+    // read_addr/write_addr. Only valid until the next write to ROM_RANGE (MBC registers)
+    const uint8_t* get_read_ptr(uint16_t addr) const;
+    uint8_t* get_write_ptr(uint16_t addr);
+
+    std::span<const uint8_t> get_rom() const { return m_data; } // the whole file, every bank
+    // the bank mapped at 0x4000-0x7FFF
+    int get_rom_bank() const { return int(get_rom_offset(0x4000) / 0x4000); }
+
     static constexpr iRange ROM_RANGE = iRange{0x0000, 0x8000};
     static constexpr iRange RAM_RANGE = iRange{0xA000, 0xC000};
 
@@ -66,6 +75,7 @@ class Cart {
 
   private:
     const uint8_t* get_rom_ptr(uint16_t addr) const;
+    size_t get_rom_offset(uint16_t addr) const; // into m_data, can be past the end of it
     // todo, add RAM bank switching
     uint8_t* get_ram_ptr(uint16_t addr) {
         return m_mbc1State.m_ram.data() + (addr - RAM_RANGE.m_min);
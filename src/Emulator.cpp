@@ -9,6 +9,9 @@ Emulator::Emulator(Cart& cart, EmuSettings settings)
     : m_cart(cart)
     , m_settings(settings) {
 
+    m_ppu.set_display_format(m_settings.m_displayFormat);
+    m_ppu.set_display_colors(m_settings.m_displayColors);
+
     static constexpr bool loadBootromFromFile = false;
     if(loadBootromFromFile){
         const auto bootromPath = "./roms/bootix_dmg.bin";
@@ -38,116 +41,43 @@ Emulator::Emulator(Cart& cart, EmuSettings settings)
         m_ioReg->m_bootromDisabled = true;
         m_ioReg->m_lcd.m_control.m_ppuEnable = true;
     }
-}
-
-uint16_t Emulator::read_R16Mem(R16Mem r16) const {
-    switch (r16) {
-        case R16Mem::BC:  return m_reg.bc;
-        case R16Mem::DE:  return m_reg.de;
-        case R16Mem::HLI: return m_reg.hl;
-        case R16Mem::HLD: return m_reg.hl;
-        default:          fail("not implemented");
-    }
-}
-
-bool Emulator::get_Cond(Cond c) const {
-    switch (c) {
-        case Cond::Z:  return get_flag(Flag::ZERO);
-        case Cond::NZ: return !get_flag(Flag::ZERO);
-        case Cond::C:  return get_flag(Flag::CARRY);
-        case Cond::NC: return !get_flag(Flag::CARRY);
-        default:       fail("not implemented");
-    }
-}
-
-uint16_t Emulator::read_R16(R16 r16) const {
-    switch (r16) {
-        case R16::BC: return m_reg.bc;
-        case R16::DE: return m_reg.de;
-        case R16::HL: return m_reg.hl;
-        case R16::SP: return m_reg.sp;
-        default:      fail("not implemented");
-    }
-}
 
-void Emulator::write_R16(R16 r16, uint16_t data) {
-    switch (r16) {
-        case R16::BC: m_reg.bc = data; break;
-        case R16::DE: m_reg.de = data; break;
-        case R16::HL: m_reg.hl = data; break;
-        case R16::SP: m_reg.sp = data; break;
-        default:      fail("not implemented");
-    }
-}
-
-uint16_t Emulator::read_R16Stack(R16Stack r16) const {
-    switch (r16) {
-        case R16Stack::BC: return m_reg.bc;
-        case R16Stack::DE: return m_reg.de;
-        case R16Stack::HL: return m_reg.hl;
-        case R16Stack::AF: return m_reg.af;
-        default:           fail("not implemented");
-    }
-}
-
-void Emulator::write_R16Stack(R16Stack r16, uint16_t data) {
-    switch (r16) {
-        case R16Stack::BC: m_reg.bc = data; break;
-        case R16Stack::DE: m_reg.de = data; break;
-        case R16Stack::HL: m_reg.hl = data; break;
-        case R16Stack::AF: {
-            m_reg.af = data;
-            m_reg.f &= 0xF0; // bottom bits of flags are always 0
-            break;
+    if (m_settings.m_compiledRom) {
+        const auto rom = m_cart.get_rom();
+        if (m_settings.m_compiledRom->m_romHash == hash_rom(rom)) {
+            for (const auto& block : m_settings.m_compiledRom->m_blocks) {
+                ez_assert(block.m_romOffset < rom.size());
+                m_compiledBlocks.emplace(rom.data() + block.m_romOffset, block.m_fn);
+            }
+            log_info("Loaded {} compiled blocks", m_compiledBlocks.size());
+        } else {
+            log_warn("Compiled blocks were built from a different ROM, ignoring them");
         }
-        default: fail("not implemented");
     }
-}
 
-uint8_t Emulator::read_R8(R8 r8) const {
-    switch (r8) {
-        case R8::B:       return m_reg.b;
-        case R8::C:       return m_reg.c;
-        case R8::D:       return m_reg.d;
-        case R8::E:       return m_reg.e;
-        case R8::H:       return m_reg.h;
-        case R8::L:       return m_reg.l;
-        case R8::HL_ADDR: return read_addr(m_reg.hl);
-        case R8::A:       return m_reg.a;
-        default:          fail("not implemented");
-    }
-}
-
-void Emulator::write_R8(R8 r8, uint8_t data) {
-    switch (r8) {
-        case R8::B:       m_reg.b = data; break;
-        case R8::C:       m_reg.c = data; break;
-        case R8::D:       m_reg.d = data; break;
-        case R8::E:       m_reg.e = data; break;
-        case R8::H:       m_reg.h = data; break;
-        case R8::L:       m_reg.l = data; break;
-        case R8::HL_ADDR: write_addr(m_reg.hl, data); break;
-        case R8::A:       m_reg.a = data; break;
-        default:          fail("not implemented");
-    }
+    map_pages();
+    schedule_tima_overflow();
+    update_ppu_event_cycle();
 }
 
-InstructionResult Emulator::handle_instr_prefixed(uint32_t pcData) {
-
-    const auto opByte = static_cast<uint8_t>(pcData & 0x000000FF);
+template <typename TOpByte>
+InstructionResult Emulator::handle_instr_prefixed(uint32_t, TOpByte opByte) {
+    using Policy = typename PolicyOf<TOpByte>::type;
 
     const auto top2Bits = (opByte & 0b11000000) >> 6;
     const auto top5Bits = (opByte & 0b11111000) >> 3;
     const auto bitIndex = (opByte & 0b00111000) >> 3;
 
-    const auto info = get_opcode_info_prefixed(opByte);
+    const auto& timing = OPCODE_TIMINGS_PREFIXED[opByte];
 
-    auto r8 = R8{opByte & 0b00000111};
+    const auto r8 = R8{opByte & 0b00000111};
 
     bool branched = false;
     auto jumpAddr = std::optional<uint16_t>{};
 
-    maybe_log_opcode(info);
+    if constexpr (Policy::LOGGING) {
+        maybe_log_opcode(opByte, true);
+    }
 
     switch (top2Bits) {
         case 0b01: // BIT r8 bitIndex
@@ -159,10 +89,10 @@ InstructionResult Emulator::handle_instr_prefixed(uint32_t pcData) {
             break;
         }
         case 0b10: // RES
-            write_R8(r8, read_R8(r8) & ~(0b1 << bitIndex));
+            write_R8<Policy>(r8, read_R8(r8) & ~(0b1 << bitIndex));
             break;
         case 0b11: // SET
-            write_R8(r8, read_R8(r8) | (0b1 << bitIndex));
+            write_R8<Policy>(r8, read_R8(r8) | (0b1 << bitIndex));
             break;
         case 0b00: {
             switch (top5Bits) {
@@ -171,7 +101,7 @@ InstructionResult Emulator::handle_instr_prefixed(uint32_t pcData) {
                     auto r8v = read_R8(r8);
                     const auto topBit = r8v & 0b1000'0000;
                     const uint8_t result = (r8v << 1) | (topBit ? 0b1 : 0b0);
-                    write_R8(r8, result);
+                    write_R8<Policy>(r8, result);
                     clear_all_flags();
                     set_flag(Flag::CARRY, topBit);
                     set_flag(Flag::ZERO, result == 0);
@@ -182,7 +112,7 @@ InstructionResult Emulator::handle_instr_prefixed(uint32_t pcData) {
                     const auto r8v = read_R8(r8);
                     const auto bottomBit = r8v & 0b1;
                     const uint8_t result = (r8v >> 1) | (bottomBit ? 0b1000'0000 : 0b0);
-                    write_R8(r8, result);
+                    write_R8<Policy>(r8, result);
                     clear_all_flags();
                     set_flag(Flag::CARRY, bottomBit);
                     set_flag(Flag::ZERO, result == 0);
@@ -193,7 +123,7 @@ InstructionResult Emulator::handle_instr_prefixed(uint32_t pcData) {
                     const auto setCarry = bool(0b1000'0000 & r8val);
                     const uint8_t lastBit = get_flag(Flag::CARRY) ? 0b1 : 0b0;
                     r8val = (r8val << 1) | lastBit;
-                    write_R8(r8, r8val);
+                    write_R8<Policy>(r8, r8val);
                     clear_all_flags();
                     set_flag(Flag::CARRY, setCarry);
                     set_flag(Flag::ZERO, r8val == 0);
@@ -204,7 +134,7 @@ InstructionResult Emulator::handle_instr_prefixed(uint32_t pcData) {
                     const auto setCarry = bool(0b1 & r8val);
                     const uint8_t firstBit = get_flag(Flag::CARRY) ? 0b1000'0000 : 0b0;
                     r8val = (r8val >> 1) | firstBit;
-                    write_R8(r8, r8val);
+                    write_R8<Policy>(r8, r8val);
                     clear_all_flags();
                     set_flag(Flag::CARRY, setCarry);
                     set_flag(Flag::ZERO, r8val == 0);
@@ -214,7 +144,7 @@ InstructionResult Emulator::handle_instr_prefixed(uint32_t pcData) {
                 {
                     const auto r8val = read_R8(r8);
                     const uint8_t result = r8val << 1;
-                    write_R8(r8, result);
+                    write_R8<Policy>(r8, result);
                     clear_all_flags();
                     set_flag(Flag::ZERO, result == 0);
                     set_flag(Flag::CARRY, r8val & 0b1000'0000);
@@ -226,7 +156,7 @@ InstructionResult Emulator::handle_instr_prefixed(uint32_t pcData) {
                     const uint8_t signBit = 0b1000'0000 & r8val;
                     const uint8_t lowBit = 0b1 & r8val;
                     const uint8_t result = (r8val >> 1) | signBit;
-                    write_R8(r8, result);
+                    write_R8<Policy>(r8, result);
                     clear_all_flags();
                     set_flag(Flag::ZERO, result == 0);
                     set_flag(Flag::CARRY, lowBit);
@@ -237,7 +167,7 @@ InstructionResult Emulator::handle_instr_prefixed(uint32_t pcData) {
                     const auto r8v_copy = read_R8(r8);
                     auto r8v = read_R8(r8);
                     r8v = r8v << 4 | (r8v_copy >> 4);
-                    write_R8(r8, r8v);
+                    write_R8<Policy>(r8, r8v);
                     clear_all_flags();
                     set_flag(Flag::ZERO, r8v == 0);
                     break;
@@ -246,7 +176,7 @@ InstructionResult Emulator::handle_instr_prefixed(uint32_t pcData) {
                 {
                     const auto r8v = read_R8(r8);
                     const auto result = r8v >> 1;
-                    write_R8(r8, r8v >> 1);
+                    write_R8<Policy>(r8, r8v >> 1);
                     clear_all_flags();
                     set_flag(Flag::ZERO, result == 0);
                     set_flag(Flag::CARRY, r8v & 0b1);
@@ -259,25 +189,27 @@ InstructionResult Emulator::handle_instr_prefixed(uint32_t pcData) {
     }
     if (branched) {
         assert(jumpAddr);
-        if (m_settings.m_logEnable) {
-            log_info("Took branch to {:#06x}", *jumpAddr);
+        if (Policy::LOGGING && m_settings.m_logEnable) {
+            log_verbose("Took branch to {:#06x}", *jumpAddr);
         }
     }
 
-    const auto cycles = branched ? *info.m_cyclesIfBranch : info.m_cycles;
-    const auto newPC = jumpAddr ? *jumpAddr : checked_cast<uint16_t>(m_reg.pc + info.m_size);
+    const auto cycles = branched ? timing.m_cyclesIfBranch : timing.m_cycles;
+    const auto newPC = jumpAddr ? *jumpAddr : checked_cast<uint16_t>(m_reg.pc + timing.m_size);
     return InstructionResult{
         newPC,
         cycles,
     };
 }
 
-InstructionResult Emulator::handle_instr_b3(uint32_t pcData) {
+template <typename TOpByte>
+InstructionResult Emulator::handle_instr_b3([[maybe_unused]] uint32_t pcData, TOpByte opByte) {
+    using Policy = typename PolicyOf<TOpByte>::type;
 
-    const auto oc = OpCode{checked_cast<uint8_t>(pcData & 0xFF)};
+    const auto oc = OpCode{uint8_t(opByte)};
     ez_assert(((+oc & 0b11000000) >> 6) == 3);
 
-    auto info = get_opcode_info(+oc);
+    const auto& timing = OPCODE_TIMINGS[opByte];
 
     const auto u16 = static_cast<uint16_t>((pcData >> 8) & 0x0000FFFF);
     const auto u8 = static_cast<uint8_t>((pcData >> 8) & 0x000000FF);
@@ -298,7 +230,7 @@ InstructionResult Emulator::handle_instr_b3(uint32_t pcData) {
         if (condition) {
             // todo, verify timing - different values on different sources
             m_reg.sp -= 2;
-            write_addr_16(m_reg.sp, m_reg.pc + uint16_t(info.m_size));
+            write_addr_16<Policy>(m_reg.sp, m_reg.pc + uint16_t(timing.m_size));
             jumpAddr = u16;
             if (setBranched) {
                 branched = true;
@@ -324,11 +256,11 @@ InstructionResult Emulator::handle_instr_b3(uint32_t pcData) {
             assert(tgt3 == 0x08);
         }
         m_reg.sp -= 2;
-        write_addr_16(m_reg.sp, m_reg.pc + uint16_t(info.m_size));
+        write_addr_16<Policy>(m_reg.sp, m_reg.pc + uint16_t(timing.m_size));
         jumpAddr = uint16_t(tgt3);
     } else if (last4bits == 0b0101) { // push r16stack
         m_reg.sp -= sizeof(uint16_t);
-        write_addr_16(m_reg.sp, read_R16Stack(r16stack));
+        write_addr_16<Policy>(m_reg.sp, read_R16Stack(r16stack));
     } else if (last4bits == 0b0001) { // pop r16stack
         write_R16Stack(r16stack, readAddr16(m_reg.sp));
         m_reg.sp += sizeof(uint16_t);
@@ -337,23 +269,24 @@ InstructionResult Emulator::handle_instr_b3(uint32_t pcData) {
             case OpCode::PREFIX: m_prefix = true; break;
             // enable/disable interrupts after instruction after this one finishes
             case OpCode::EI:
-                if (!m_pendingInterruptEnableCycleCount) {
-                    m_pendingInterruptEnableCycleCount = 2 * T_CYCLES_PER_M_CYCLE;
+                if (!m_scheduler.is_scheduled(EventType::IME_ENABLE)) {
+                    m_scheduler.schedule(EventType::IME_ENABLE,
+                                         m_cpuCycle + 2 * T_CYCLES_PER_M_CYCLE);
                 }
                 break;
             case OpCode::DI:
                 m_interruptMasterEnable = false;
-                m_pendingInterruptEnableCycleCount = 0;
+                m_scheduler.cancel(EventType::IME_ENABLE);
                 break;
 
-            case OpCode::LD__C__A:   write_addr(0xFF00 + m_reg.c, m_reg.a); break;
+            case OpCode::LD__C__A:   write_addr<Policy>(0xFF00 + m_reg.c, m_reg.a); break;
             case OpCode::LD_A__a16_: m_reg.a = read_addr(u16); break;
             case OpCode::LDH__a8__A: {
                 const uint16_t addr = u8 + uint16_t(0xFF00);
-                write_addr(addr, m_reg.a);
+                write_addr<Policy>(addr, m_reg.a);
                 break;
             }
-            case OpCode::LD__a16__A:  write_addr(u16, m_reg.a); break;
+            case OpCode::LD__a16__A:  write_addr<Policy>(u16, m_reg.a); break;
             case OpCode::CALL_a16:    maybeDoCall(true, false); break;
             case OpCode::CALL_C_a16:  maybeDoCall(get_flag(Flag::CARRY), true); break;
             case OpCode::CALL_NC_a16: maybeDoCall(!get_flag(Flag::CARRY), true); break;
@@ -365,12 +298,7 @@ InstructionResult Emulator::handle_instr_b3(uint32_t pcData) {
             case OpCode::RET_Z:       maybeDoRet(get_flag(Flag::ZERO), true); break;
             case OpCode::RET_NZ:      maybeDoRet(!get_flag(Flag::ZERO), true); break;
             case OpCode::CP_A_u8:     {
-                const uint8_t result = m_reg.a - u8;
-                set_flag(Flag::ZERO, result == 0);
-                set_flag(Flag::CARRY, m_reg.a < u8);
-                set_flag(Flag::HALF_CARRY, (m_reg.a & 0xF) < (u8 & 0xF));
-                set_flag(Flag::NEGATIVE);
-
+                set_lazy_flags(FlagOp::SUB, m_reg.a, u8, uint8_t(m_reg.a - u8));
             } break;
             case OpCode::JP_a16:     jumpAddr = u16; break;
             case OpCode::LDH_A__a8_: {
@@ -380,50 +308,37 @@ InstructionResult Emulator::handle_instr_b3(uint32_t pcData) {
             }
             case OpCode::AND_A_u8:
                 m_reg.a &= u8;
-                clear_all_flags();
-                set_flag(Flag::ZERO, m_reg.a == 0);
-                set_flag(Flag::HALF_CARRY);
+                set_lazy_flags(FlagOp::AND, m_reg.a, u8, m_reg.a);
                 break;
             case OpCode::ADD_A_u8: {
                 const uint8_t result = m_reg.a + u8;
-                set_flag(Flag::ZERO, result == 0);
-                clear_flag(Flag::NEGATIVE);
-                set_flag(Flag::HALF_CARRY, get_flag_hc_add(m_reg.a, u8));
-                set_flag(Flag::CARRY, get_flag_c_add(m_reg.a, u8));
+                set_lazy_flags(FlagOp::ADD, m_reg.a, u8, result);
                 m_reg.a = result;
                 break;
             }
             case OpCode::SUB_A_u8: {
                 const uint8_t result = m_reg.a - u8;
-                set_flag(Flag::ZERO, result == 0);
-                set_flag(Flag::NEGATIVE, true);
-                set_flag(Flag::HALF_CARRY, get_flag_hc_sub(m_reg.a, u8));
-                set_flag(Flag::CARRY, get_flag_c_sub(m_reg.a, u8));
+                set_lazy_flags(FlagOp::SUB, m_reg.a, u8, result);
                 m_reg.a = result;
                 break;
             }
             case OpCode::XOR_A_u8: {
                 m_reg.a ^= u8;
-                clear_all_flags();
-                set_flag(Flag::ZERO, m_reg.a == 0);
+                set_lazy_flags(FlagOp::XOR, m_reg.a, u8, m_reg.a);
                 break;
             }
             case OpCode::ADC_A_u8: {
+                // wtf? https://gbdev.gg8.se/wiki/articles/ADC
                 const uint8_t carryBit = get_flag(Flag::CARRY) ? 0b1 : 0b0;
                 const uint8_t result = m_reg.a + u8 + carryBit;
-                clear_flag(Flag::NEGATIVE);
-                set_flag(Flag::ZERO, result == 0);
-                // wtf? https://gbdev.gg8.se/wiki/articles/ADC
-                set_flag(Flag::HALF_CARRY, get_flag_hc_adc(m_reg.a, u8, carryBit));
-                set_flag(Flag::CARRY, get_flag_c_adc(m_reg.a, u8, carryBit));
+                set_lazy_flags(FlagOp::ADC, m_reg.a, u8, result, carryBit);
                 m_reg.a = result;
                 break;
             }
             case OpCode::JP_HL:   jumpAddr = m_reg.hl; break;
             case OpCode::OR_A_u8: {
                 m_reg.a |= u8;
-                clear_all_flags();
-                set_flag(Flag::ZERO, m_reg.a == 0);
+                set_lazy_flags(FlagOp::OR, m_reg.a, u8, m_reg.a);
                 break;
             }
             case OpCode::JP_NZ_a16:    maybeDoJump(!get_flag(Flag::ZERO)); break;
@@ -452,10 +367,7 @@ InstructionResult Emulator::handle_instr_b3(uint32_t pcData) {
             case OpCode::SBC_A_u8: {
                 const uint8_t carryBit = get_flag(Flag::CARRY) ? 0b1 : 0;
                 const uint8_t result = m_reg.a - u8 - carryBit;
-                set_flag(Flag::NEGATIVE);
-                set_flag(Flag::ZERO, result == 0);
-                set_flag(Flag::HALF_CARRY, get_flag_hc_sbc(m_reg.a, u8, carryBit));
-                set_flag(Flag::CARRY, get_flag_c_sbc(m_reg.a, u8, carryBit));
+                set_lazy_flags(FlagOp::SBC, m_reg.a, u8, result, carryBit);
                 m_reg.a = result;
                 break;
             }
@@ -466,7 +378,7 @@ InstructionResult Emulator::handle_instr_b3(uint32_t pcData) {
             case OpCode::RETI: {
                 jumpAddr = readAddr16(m_reg.sp);
                 m_reg.sp += 2;
-                m_pendingInterruptEnableCycleCount = 2 * T_CYCLES_PER_M_CYCLE;
+                m_scheduler.schedule(EventType::IME_ENABLE, m_cpuCycle + 2 * T_CYCLES_PER_M_CYCLE);
                 break;
             }
             default: fail("not implemented: {}", +oc);
@@ -474,25 +386,26 @@ InstructionResult Emulator::handle_instr_b3(uint32_t pcData) {
     }
     if (branched) {
         assert(jumpAddr);
-        if (m_settings.m_logEnable) {
-            log_info("Took branch to {:#06x}", *jumpAddr);
+        if (Policy::LOGGING && m_settings.m_logEnable) {
+            log_verbose("Took branch to {:#06x}", *jumpAddr);
         }
     }
 
-    const auto cycles = branched ? *info.m_cyclesIfBranch : info.m_cycles;
-    const auto newPC = jumpAddr ? *jumpAddr : checked_cast<uint16_t>(m_reg.pc + info.m_size);
+    const auto cycles = branched ? timing.m_cyclesIfBranch : timing.m_cycles;
+    const auto newPC = jumpAddr ? *jumpAddr : checked_cast<uint16_t>(m_reg.pc + timing.m_size);
     return InstructionResult{
         newPC,
         cycles,
     };
 }
 
-InstructionResult Emulator::handle_instr_b2(uint32_t pcData) {
+template <typename TOpByte>
+InstructionResult Emulator::handle_instr_b2([[maybe_unused]] uint32_t pcData, TOpByte opByte) {
 
-    const auto oc = OpCode{checked_cast<uint8_t>(pcData & 0xFF)};
+    const auto oc = OpCode{uint8_t(opByte)};
     ez_assert(((+oc & 0b11000000) >> 6) == 2);
 
-    const auto info = get_opcode_info(+oc);
+    const auto& timing = OPCODE_TIMINGS[opByte];
 
     const auto top_5_bits = (+oc & 0b11111000) >> 3;
     const auto r8 = checked_cast<R8>(+oc & 0b111);
@@ -502,10 +415,7 @@ InstructionResult Emulator::handle_instr_b2(uint32_t pcData) {
         {
             const auto r8val = read_R8(r8);
             const uint8_t result = m_reg.a + r8val;
-            set_flag(Flag::ZERO, result == 0);
-            set_flag(Flag::NEGATIVE, false);
-            set_flag(Flag::HALF_CARRY, get_flag_hc_add(m_reg.a, r8val));
-            set_flag(Flag::CARRY, get_flag_c_add(m_reg.a, r8val));
+            set_lazy_flags(FlagOp::ADD, m_reg.a, r8val, result);
             m_reg.a = result;
             break;
         }
@@ -514,10 +424,7 @@ InstructionResult Emulator::handle_instr_b2(uint32_t pcData) {
             const auto r8v = read_R8(r8);
             const uint8_t carryBit = get_flag(Flag::CARRY) ? 0b1 : 0b0;
             const uint8_t result = m_reg.a + r8v + carryBit;
-            clear_flag(Flag::NEGATIVE);
-            set_flag(Flag::ZERO, result == 0);
-            set_flag(Flag::HALF_CARRY, get_flag_hc_adc(m_reg.a, r8v, carryBit));
-            set_flag(Flag::CARRY, get_flag_c_adc(m_reg.a, r8v, carryBit));
+            set_lazy_flags(FlagOp::ADC, m_reg.a, r8v, result, carryBit);
             m_reg.a = result;
             break;
         }
@@ -525,10 +432,7 @@ InstructionResult Emulator::handle_instr_b2(uint32_t pcData) {
         {
             const auto r8val = read_R8(r8);
             const uint8_t result = m_reg.a - r8val;
-            set_flag(Flag::ZERO, result == 0);
-            set_flag(Flag::NEGATIVE, true);
-            set_flag(Flag::HALF_CARRY, ((m_reg.a & 0xF) - (r8val & 0xF)) & 0x10);
-            set_flag(Flag::CARRY, m_reg.a < r8val);
+            set_lazy_flags(FlagOp::SUB, m_reg.a, r8val, result);
             m_reg.a = result;
             break;
         }
@@ -537,54 +441,54 @@ InstructionResult Emulator::handle_instr_b2(uint32_t pcData) {
             const uint8_t carryBit = get_flag(Flag::CARRY) ? 0b1 : 0;
             const auto r8v = read_R8(r8);
             const uint8_t result = m_reg.a - r8v - carryBit;
-            set_flag(Flag::NEGATIVE);
-            set_flag(Flag::ZERO, result == 0);
-            set_flag(Flag::HALF_CARRY, get_flag_hc_sbc(m_reg.a, r8v, carryBit));
-            set_flag(Flag::CARRY, get_flag_c_sbc(m_reg.a, r8v, carryBit));
+            set_lazy_flags(FlagOp::SBC, m_reg.a, r8v, result, carryBit);
             m_reg.a = result;
             break;
         }
         case 0b10100: // and a, r8
-            m_reg.a &= read_R8(r8);
-            clear_all_flags();
-            set_flag(Flag::ZERO, m_reg.a == 0);
-            set_flag(Flag::HALF_CARRY);
+        {
+            const auto r8val = read_R8(r8);
+            m_reg.a &= r8val;
+            set_lazy_flags(FlagOp::AND, m_reg.a, r8val, m_reg.a);
             break;
+        }
         case 0b10101: // xor a, r8
-            m_reg.a ^= read_R8(r8);
-            clear_all_flags();
-            set_flag(Flag::ZERO, m_reg.a == 0);
+        {
+            const auto r8val = read_R8(r8);
+            m_reg.a ^= r8val;
+            set_lazy_flags(FlagOp::XOR, m_reg.a, r8val, m_reg.a);
             break;
+        }
         case 0b10110: // or a, r8
-            m_reg.a = m_reg.a | read_R8(r8);
-            clear_all_flags();
-            set_flag(Flag::ZERO, m_reg.a == 0);
+        {
+            const auto r8val = read_R8(r8);
+            m_reg.a |= r8val;
+            set_lazy_flags(FlagOp::OR, m_reg.a, r8val, m_reg.a);
             break;
+        }
         case 0b10111: // cp a, r8
         {
             const auto r8val = read_R8(r8);
-            const uint8_t result = m_reg.a - r8val;
-            set_flag(Flag::ZERO, result == 0);
-            set_flag(Flag::NEGATIVE, true);
-            set_flag(Flag::HALF_CARRY, ((m_reg.a & 0xF) - (r8val & 0xF)) & 0x10);
-            set_flag(Flag::CARRY, m_reg.a < r8val);
+            set_lazy_flags(FlagOp::SUB, m_reg.a, r8val, uint8_t(m_reg.a - r8val));
             break;
         }
         default: fail("not implemented");
     }
 
     return InstructionResult{
-        checked_cast<uint16_t>(m_reg.pc + info.m_size),
-        info.m_cycles,
+        checked_cast<uint16_t>(m_reg.pc + timing.m_size),
+        timing.m_cycles,
     };
 }
 
-InstructionResult Emulator::handle_instr_b1(uint32_t pcData) {
+template <typename TOpByte>
+InstructionResult Emulator::handle_instr_b1([[maybe_unused]] uint32_t pcData, TOpByte opByte) {
+    using Policy = typename PolicyOf<TOpByte>::type;
 
-    const auto oc = OpCode{checked_cast<uint8_t>(pcData & 0xFF)};
+    const auto oc = OpCode{uint8_t(opByte)};
     ez_assert(((+oc & 0b11000000) >> 6) == 0b01);
 
-    const auto info = get_opcode_info(+oc);
+    const auto& timing = OPCODE_TIMINGS[opByte];
 
     const auto srcR8 = checked_cast<R8>(+oc & 0b111);
     const auto dstR8 = checked_cast<R8>((+oc & 0b111000) >> 3);
@@ -593,24 +497,26 @@ InstructionResult Emulator::handle_instr_b1(uint32_t pcData) {
         // HALT
         m_haltMode = true;
         m_isInstructionAfterHaltMode = true;
-        if (m_settings.m_logEnable) {
-            log_info("Enabling Halt Mode");
+        if (Policy::LOGGING && m_settings.m_logEnable) {
+            log_verbose("Enabling Halt Mode");
         }
     } else {
-        write_R8(dstR8, read_R8(srcR8));
+        write_R8<Policy>(dstR8, read_R8(srcR8));
     }
     return InstructionResult{
-        checked_cast<uint16_t>(m_reg.pc + info.m_size),
-        info.m_cycles,
+        checked_cast<uint16_t>(m_reg.pc + timing.m_size),
+        timing.m_cycles,
     };
 }
 
-InstructionResult Emulator::handle_instr_b0(uint32_t pcData) {
+template <typename TOpByte>
+InstructionResult Emulator::handle_instr_b0([[maybe_unused]] uint32_t pcData, TOpByte opByte) {
+    using Policy = typename PolicyOf<TOpByte>::type;
 
-    const auto oc = OpCode{checked_cast<uint8_t>(pcData & 0xFF)};
+    const auto oc = OpCode{uint8_t(opByte)};
     ez_assert(((+oc & 0b11000000) >> 6) == 0);
 
-    const auto info = get_opcode_info(+oc);
+    const auto& timing = OPCODE_TIMINGS[opByte];
 
     bool branched = false;
     auto jumpAddr = std::optional<uint16_t>{};
@@ -643,7 +549,7 @@ InstructionResult Emulator::handle_instr_b0(uint32_t pcData) {
     if (is_ld_r16_u16) {
         write_R16(r16, u16);
     } else if (is_ld_r16mem_a) {
-        write_addr(read_R16Mem(r16mem), m_reg.a);
+        write_addr<Policy>(read_R16Mem(r16mem), m_reg.a);
         if (r16mem == R16Mem::HLD) {
             --m_reg.hl;
         } else if (r16mem == R16Mem::HLI) {
@@ -670,24 +576,20 @@ InstructionResult Emulator::handle_instr_b0(uint32_t pcData) {
     } else if (is_inc_r8) {
         const auto r8val = read_R8(r8);
         const uint8_t result = r8val + 1;
-        set_flag(Flag::ZERO, result == 0);
-        set_flag(Flag::HALF_CARRY, get_flag_hc_add(r8val, 1));
-        clear_flag(Flag::NEGATIVE);
-        write_R8(r8, result);
+        set_lazy_flags(FlagOp::INC, r8val, 1, result, get_flag(Flag::CARRY));
+        write_R8<Policy>(r8, result);
     } else if (is_dec_r8) {
         const auto r8val = read_R8(r8);
         const uint8_t result = r8val - 1;
-        set_flag(Flag::ZERO, result == 0);
-        set_flag(Flag::HALF_CARRY, get_flag_hc_sub(r8val, 1));
-        set_flag(Flag::NEGATIVE);
-        write_R8(r8, result);
+        set_lazy_flags(FlagOp::DEC, r8val, 1, result, get_flag(Flag::CARRY));
+        write_R8<Policy>(r8, result);
     } else if (is_ld_r8_u8) {
-        write_R8(r8, u8);
+        write_R8<Policy>(r8, u8);
     } else if (is_jr_cond_a8 || oc == OpCode::JR_i8) {
         const auto cond = checked_cast<Cond>(((+oc & 0b11000) >> 3));
         if (oc == OpCode::JR_i8 || get_Cond(cond)) {
             branched = oc != OpCode::JR_i8;
-            jumpAddr = checked_cast<uint16_t>(m_reg.pc + info.m_size + i8);
+            jumpAddr = checked_cast<uint16_t>(m_reg.pc + timing.m_size + i8);
         }
     } else {
         switch (oc) {
@@ -699,7 +601,7 @@ InstructionResult Emulator::handle_instr_b0(uint32_t pcData) {
                 clear_all_flags();
                 set_flag(Flag::CARRY, set_carry);
             } break;
-            case OpCode::LD__a16__SP: write_addr_16(u16, m_reg.sp); break;
+            case OpCode::LD__a16__SP: write_addr_16<Policy>(u16, m_reg.sp); break;
             case OpCode::RRA:         {
                 const auto setCarry = bool(0b1 & m_reg.a);
                 const uint8_t firstBit = get_flag(Flag::CARRY) ? 0b1000'0000 : 0b0;
@@ -728,7 +630,7 @@ InstructionResult Emulator::handle_instr_b0(uint32_t pcData) {
                     log_warn("GBC Speed toggle ignored");
                 } else {
                     m_stopMode = true;
-                    m_ioReg->m_timerDivider = 0;
+                    reset_div();
                 }
                 break;
             }
@@ -786,12 +688,12 @@ InstructionResult Emulator::handle_instr_b0(uint32_t pcData) {
 
     if (branched) {
         assert(jumpAddr);
-        if (m_settings.m_logEnable) {
-            log_info("Took branch to {:#06x}", *jumpAddr);
+        if (Policy::LOGGING && m_settings.m_logEnable) {
+            log_verbose("Took branch to {:#06x}", *jumpAddr);
         }
     }
-    const auto cycles = branched ? *info.m_cyclesIfBranch : info.m_cycles;
-    const auto newPC = jumpAddr.value_or(checked_cast<uint16_t>(m_reg.pc + info.m_size));
+    const auto cycles = branched ? timing.m_cyclesIfBranch : timing.m_cycles;
+    const auto newPC = jumpAddr.value_or(checked_cast<uint16_t>(m_reg.pc + timing.m_size));
     return InstructionResult{
         newPC,
         cycles,
@@ -802,165 +704,799 @@ InstructionResult Emulator::handle_instr(uint32_t pcData) {
 
     EZ_ENSURE(!m_prefix);
 
-    const auto oc = OpCode{static_cast<uint8_t>(pcData & 0x000000FF)};
-    const auto info = get_opcode_info(+oc);
-    maybe_log_opcode(info);
+    const auto opByte = static_cast<uint8_t>(pcData & 0x000000FF);
+    maybe_log_opcode(opByte, false);
 
-    const auto block = (+oc & 0b11000000) >> 6;
+    const auto block = (opByte & 0b11000000) >> 6;
     switch (block) {
-        case 0b00: return handle_instr_b0(pcData); break;
-        case 0b01: return handle_instr_b1(pcData); break;
-        case 0b10: return handle_instr_b2(pcData); break;
-        case 0b11: return handle_instr_b3(pcData); break;
+        case 0b00: return handle_instr_b0(pcData, opByte); break;
+        case 0b01: return handle_instr_b1(pcData, opByte); break;
+        case 0b10: return handle_instr_b2(pcData, opByte); break;
+        case 0b11: return handle_instr_b3(pcData, opByte); break;
         default:   fail("should never get here"); break;
     }
 }
 
-bool Emulator::get_flag(Flag flag) const { return ((0x1 << +flag) & m_reg.f) != 0x0; }
+InstructionResult Emulator::handle_instr_prefixed(uint32_t pcData) {
+    return handle_instr_prefixed(pcData, static_cast<uint8_t>(pcData & 0x000000FF));
+}
 
-void Emulator::set_flag(Flag flag) { m_reg.f |= (0x1 << +flag); }
+template <uint8_t OP, typename TPolicy>
+InstructionResult Emulator::dispatch_op(Emulator& emu, uint32_t pcData) {
+    const auto opByte = OpConst<OP, TPolicy>{};
+    if constexpr (TPolicy::LOGGING) {
+        emu.maybe_log_opcode(OP, false);
+    }
+    if constexpr ((OP >> 6) == 0b00) {
+        return emu.handle_instr_b0(pcData, opByte);
+    } else if constexpr ((OP >> 6) == 0b01) {
+        return emu.handle_instr_b1(pcData, opByte);
+    } else if constexpr ((OP >> 6) == 0b10) {
+        return emu.handle_instr_b2(pcData, opByte);
+    } else {
+        return emu.handle_instr_b3(pcData, opByte);
+    }
+}
 
-void Emulator::set_flag(Flag flag, bool value) { return value ? set_flag(flag) : clear_flag(flag); }
+template <uint8_t OP, typename TPolicy>
+InstructionResult Emulator::dispatch_op_prefixed(Emulator& emu, uint32_t pcData) {
+    return emu.handle_instr_prefixed(pcData, OpConst<OP, TPolicy>{});
+}
 
-void Emulator::clear_flag(Flag flag) { m_reg.f &= ~(0x1 << +flag); }
+// blocks generated by ezgb_recompile call the handlers from their own translation unit
+#define EZ_INSTANTIATE_OP(OP)                                                                      \
+    template InstructionResult Emulator::dispatch_op<OP, FastPolicy>(Emulator&, uint32_t);         \
+    template InstructionResult Emulator::dispatch_op_prefixed<OP, FastPolicy>(Emulator&, uint32_t);
+#define EZ_INSTANTIATE_OP_ROW(ROW)                                                                 \
+    EZ_INSTANTIATE_OP(ROW + 0x0) EZ_INSTANTIATE_OP(ROW + 0x1) EZ_INSTANTIATE_OP(ROW + 0x2)         \
+    EZ_INSTANTIATE_OP(ROW + 0x3) EZ_INSTANTIATE_OP(ROW + 0x4) EZ_INSTANTIATE_OP(ROW + 0x5)         \
+    EZ_INSTANTIATE_OP(ROW + 0x6) EZ_INSTANTIATE_OP(ROW + 0x7) EZ_INSTANTIATE_OP(ROW + 0x8)         \
+    EZ_INSTANTIATE_OP(ROW + 0x9) EZ_INSTANTIATE_OP(ROW + 0xA) EZ_INSTANTIATE_OP(ROW + 0xB)         \
+    EZ_INSTANTIATE_OP(ROW + 0xC) EZ_INSTANTIATE_OP(ROW + 0xD) EZ_INSTANTIATE_OP(ROW + 0xE)         \
+    EZ_INSTANTIATE_OP(ROW + 0xF)
+EZ_INSTANTIATE_OP_ROW(0x00)
+EZ_INSTANTIATE_OP_ROW(0x10)
+EZ_INSTANTIATE_OP_ROW(0x20)
+EZ_INSTANTIATE_OP_ROW(0x30)
+EZ_INSTANTIATE_OP_ROW(0x40)
+EZ_INSTANTIATE_OP_ROW(0x50)
+EZ_INSTANTIATE_OP_ROW(0x60)
+EZ_INSTANTIATE_OP_ROW(0x70)
+EZ_INSTANTIATE_OP_ROW(0x80)
+EZ_INSTANTIATE_OP_ROW(0x90)
+EZ_INSTANTIATE_OP_ROW(0xA0)
+EZ_INSTANTIATE_OP_ROW(0xB0)
+EZ_INSTANTIATE_OP_ROW(0xC0)
+EZ_INSTANTIATE_OP_ROW(0xD0)
+EZ_INSTANTIATE_OP_ROW(0xE0)
+EZ_INSTANTIATE_OP_ROW(0xF0)
+#undef EZ_INSTANTIATE_OP_ROW
+#undef EZ_INSTANTIATE_OP
+
+template <typename TPolicy>
+const std::array<Emulator::OpHandler, 256> Emulator::s_opTable =
+    []<size_t... OPS>(std::index_sequence<OPS...>) {
+        return std::array<OpHandler, 256>{&dispatch_op<uint8_t(OPS), TPolicy>...};
+    }(std::make_index_sequence<256>{});
+
+template <typename TPolicy>
+const std::array<Emulator::OpHandler, 256> Emulator::s_opTablePrefixed =
+    []<size_t... OPS>(std::index_sequence<OPS...>) {
+        return std::array<OpHandler, 256>{&dispatch_op_prefixed<uint8_t(OPS), TPolicy>...};
+    }(std::make_index_sequence<256>{});
+
+InstructionResult Emulator::execute_instr(uint32_t pcData) {
+    const auto opByte = static_cast<uint8_t>(pcData & 0x000000FF);
+    if (m_settings.m_cpuDispatch != CpuDispatch::SWITCH) {
+        if (m_prefix) {
+            m_prefix = false;
+            const auto& table =
+                m_debugPolicy ? s_opTablePrefixed<DebugPolicy> : s_opTablePrefixed<FastPolicy>;
+            return table[opByte](*this, pcData);
+        }
+        const auto& table = m_debugPolicy ? s_opTable<DebugPolicy> : s_opTable<FastPolicy>;
+        return table[opByte](*this, pcData);
+    }
 
-void Emulator::clear_all_flags() { m_reg.f = 0x00; }
+    if (m_prefix) {
+        m_prefix = false;
+        return handle_instr_prefixed(pcData);
+    }
+    return handle_instr(pcData);
+}
 
 void Emulator::tick(const InputState& input) {
     m_inputState = input;
+    run_for(1);
+}
 
-    auto handledInstructionOrInterrupt = false;
-
+void Emulator::run_for(int64_t cycles) {
     if (m_stopMode) {
         // todo, recover from stop mode!
         return;
     }
 
-    tick_countdowns();
-    m_executedInstructionThisCycle = m_cyclesToWait == 0;
+    const auto debugPolicy =
+        m_settings.m_debugHooks || m_settings.m_logEnable || m_trace || m_profiling;
+    if (debugPolicy != m_debugPolicy) {
+        clear_blocks(); // their handlers are the other policy's
+        m_debugPolicy = debugPolicy;
+    }
 
-    tick_timers();
+    auto targetCycle = m_cycleCounter + cycles;
+    while (m_cpuCycle < targetCycle) {
+        sync_timers(m_cpuCycle);
+        // STAT, LY, IF and VRAM/OAM locking only change on PPU events, between them the PPU can lag
+        if (m_ppuEventCycle < m_cpuCycle) {
+            sync_ppu(m_cpuCycle - 1);
+        }
+        step_cpu(targetCycle);
+        if (m_stopMode) {
+            // nothing runs after the cycle STOP executed on
+            targetCycle = m_lastCpuCycle + 1;
+            break;
+        }
+    }
 
-    // prefix instructions are atomic
-    if (m_cyclesToWait == 0 && !m_prefix) {
-        tick_interrupts();
-        handledInstructionOrInterrupt = m_cyclesToWait != 0;
+    sync_timers(targetCycle - 1);
+    sync_ppu(targetCycle - 1);
+    sync_apu(targetCycle - 1);
+    // the debugger and tests read m_reg and m_ioReg directly
+    sync_flags();
+    sync_tima(targetCycle);
+    m_ioReg->m_timerDivider = uint8_t(get_sysclk(targetCycle) >> 8);
+    m_executedInstructionThisCycle = m_lastCpuCycle == targetCycle - 1;
+    m_cycleCounter = targetCycle;
+}
+
+int64_t Emulator::run_until_vblank() {
+    const auto startCycle = m_cycleCounter;
+    const auto startFrame = m_ppu.get_frame_count();
+    while (m_ppu.get_frame_count() == startFrame && !m_stopMode) {
+        const auto elapsed = m_cycleCounter - startCycle;
+        if (!m_ppu.is_enabled() && elapsed >= PPU::DOTS_PER_FRAME) {
+            break;
+        }
+        const auto toFrameEnd = std::max<int64_t>(PPU::DOTS_PER_FRAME - elapsed, 1);
+        run_for(std::min<int64_t>(m_ppu.get_dots_until_next_event(), toFrameEnd));
     }
+    return m_cycleCounter - startCycle;
+}
 
-    if (m_haltMode && m_cyclesToWait == 0) {
-        m_cyclesToWait = T_CYCLES_PER_M_CYCLE;
+int64_t Emulator::step() {
+    if (m_stopMode) {
+        return 0;
     }
+    const auto cycles = m_cpuCycle - m_cycleCounter + 1;
+    run_for(cycles);
+    return cycles;
+}
 
-    if (m_cyclesToWait == 0) {
-        const auto word0 = readAddr16(m_reg.pc);
-        const auto word1 = readAddr16(m_reg.pc + 2);
-        const auto pcData = (uint32_t(word1) << 16) | (uint32_t(word0));
-        auto result = InstructionResult{0, 1};
-        maybe_log_registers();
-        if (m_prefix) {
-            m_prefix = false;
-            result = handle_instr_prefixed(pcData);
+void Emulator::step_cpu(int64_t untilCycle) {
+    m_lastCpuCycle = m_cpuCycle;
+
+    int64_t cycles = 0;
+    // prefix instructions are atomic
+    if (!m_prefix && dispatch_interrupts()) {
+        cycles = 5 * T_CYCLES_PER_M_CYCLE;
+        m_idleLoop.m_start = -1;
+    } else if (m_haltMode) {
+        m_idleLoop.m_start = -1;
+        // nothing the CPU can see changes until an enabled interrupt is requested, so jump straight
+        // to the M-cycle it could first be serviced on instead of idling one M-cycle at a time
+        const auto wakeCycle = std::min(get_next_interrupt_cycle(), untilCycle);
+        const auto idleCycles = std::max<int64_t>(wakeCycle - m_cpuCycle, 1);
+        cycles = (idleCycles + T_CYCLES_PER_M_CYCLE - 1) / T_CYCLES_PER_M_CYCLE *
+                 T_CYCLES_PER_M_CYCLE;
+        m_lastCpuCycle = m_cpuCycle + cycles - T_CYCLES_PER_M_CYCLE;
+    } else if (m_idleLoop.m_start == m_reg.pc && try_skip_idle_loop(untilCycle)) {
+        return;
+    } else if ((m_settings.m_cpuDispatch == CpuDispatch::CACHED ||
+                m_settings.m_cpuDispatch == CpuDispatch::JIT) &&
+               find_block()) {
+        if (m_debugPolicy) {
+            run_blocks<DebugPolicy>(untilCycle);
         } else {
-            result = handle_instr(pcData);
+            run_blocks<FastPolicy>(untilCycle);
         }
+        return;
+    } else {
+        const auto pc = m_reg.pc;
+        const auto pcData = read_pc_data();
+        const auto prefixed = m_prefix;
+        maybe_log_registers();
+        maybe_trace_instr(uint8_t(pcData));
+        const auto result = execute_instr(pcData);
+        maybe_profile_instr(pc, uint8_t(pcData), prefixed, result.m_cycles);
         if (!m_haltBugTriggered) {
             m_reg.pc = result.m_newPC;
         } else {
             log_warn("Halt bug triggered, skipping PC increment");
         }
         m_haltBugTriggered = false;
-        m_cyclesToWait = result.m_cycles;
-        handledInstructionOrInterrupt = true;
+        cycles = result.m_cycles;
+        track_idle_loop(pc, m_reg.pc, result.m_cycles);
+        ++m_instructionCounter;
+        assert(m_cpuCycle % T_CYCLES_PER_M_CYCLE == 0);
     }
 
-    assert(m_cyclesToWait > 0);
-    if (handledInstructionOrInterrupt) {
-        assert((m_cyclesToWait) % T_CYCLES_PER_M_CYCLE == 0);
-        assert(m_cycleCounter % T_CYCLES_PER_M_CYCLE == 0);
+    assert(cycles > 0 && cycles % T_CYCLES_PER_M_CYCLE == 0);
+    m_cpuCycle += cycles;
+}
+
+bool Emulator::find_block() {
+    if (m_block && m_blockPC == m_reg.pc) {
+        return true;
+    }
+    m_block = nullptr;
+    if (m_prefix) {
+        // decode_block keeps both halves of a CB instruction together, never start between them
+        return false;
     }
+    const auto code = get_code_ptr(m_reg.pc);
+    if (!code) {
+        return false;
+    }
+    if (!m_compiledBlocks.empty() && !m_debugPolicy) {
+        const auto it = m_compiledBlocks.find(code);
+        if (it != m_compiledBlocks.end()) {
+            m_compiledBlock = it->second;
+            return true;
+        }
+    }
+    auto block = m_blockCache.find(code);
+    if (!block) {
+        const auto writable = m_reg.pc >= Cart::ROM_RANGE.m_max;
+        auto decoded = m_debugPolicy ? decode_block<DebugPolicy>(m_reg.pc, code)
+                                     : decode_block<FastPolicy>(m_reg.pc, code);
+        block = &m_blockCache.insert(code, std::move(decoded), writable);
+        if (HRAM_ADDR_RANGE.containsExclusive(m_reg.pc)) {
+            m_hramCode = true;
+        } else if (writable) {
+            const auto ramPage = int(code - m_ram.data()) / PAGE_SIZE;
+            if (!m_ramCodePages[ramPage]) {
+                protect_ram_page(ramPage, true);
+            }
+        }
+    }
+    if (block->m_instrs.empty()) {
+        return false;
+    }
+    m_block = block;
+    m_blockIndex = 0;
+    m_blockPC = m_reg.pc;
+    if (m_settings.m_cpuDispatch == CpuDispatch::JIT && !m_debugPolicy && !block->m_jitFn &&
+        block->m_runs < Jit::HOT_RUNS && ++block->m_runs == Jit::HOT_RUNS) {
+        compile_block(*block);
+    }
+    return true;
+}
 
-    m_apu.tick();
-    m_ppu.tick();
+template <typename TPolicy>
+void Emulator::run_blocks(int64_t untilCycle) {
+    do {
+        if (m_compiledBlock) {
+            const auto compiledBlock = m_compiledBlock;
+            m_compiledBlock = nullptr;
+            if (compiledBlock(*this, untilCycle) == CompiledStep::STOP) {
+                return;
+            }
+            continue;
+        }
+        // compiled with FastPolicy handlers, find_block doesn't compile any others
+        if constexpr (std::is_same_v<TPolicy, FastPolicy>) {
+            // the halt bug repeats the first instruction, only its handler knows how
+            if (m_block->m_jitFn && m_settings.m_cpuDispatch == CpuDispatch::JIT &&
+                !m_haltBugTriggered) {
+                begin_block_instr<FastPolicy>();
+                sync_flags();
+                m_jitSyncCycle = get_next_sync_cycle(untilCycle);
+                if (m_block->m_jitFn(*this, untilCycle, m_blockIndex) == CompiledStep::STOP) {
+                    return;
+                }
+                continue;
+            }
+        }
+        const auto& instr = m_block->m_instrs[m_blockIndex];
+        ez_assert(instr.m_prefixed == m_prefix);
+        if constexpr (TPolicy::LOGGING) {
+            maybe_trace_instr(uint8_t(instr.m_pcData));
+        }
+        const auto pc = begin_block_instr<TPolicy>();
+        const auto result = instr.m_handler(*this, instr.m_pcData);
+        if constexpr (TPolicy::LOGGING) {
+            maybe_profile_instr(pc, uint8_t(instr.m_pcData), instr.m_prefixed, result.m_cycles);
+        }
+        const auto canContinue = end_block_instr<TPolicy>(pc, result, untilCycle);
+        next_block_instr(uint16_t(pc + instr.m_size));
+        if (!canContinue) {
+            return;
+        }
+    } while (find_block());
+}
 
-    ++m_cycleCounter;
+void Emulator::next_block_instr(uint16_t nextPC) {
+    // a write may have dropped the block
+    if (m_block && m_reg.pc == nextPC && m_blockIndex + 1 < int(m_block->m_instrs.size())) {
+        ++m_blockIndex;
+        m_blockPC = nextPC;
+    } else {
+        m_block = nullptr;
+    }
+}
 
-    return;
+void Emulator::compile_block(Block& block) {
+    block.m_jitFn = m_jit.compile(block);
+    if (!block.m_jitFn && m_jit.get_block_count() > 0) {
+        // out of room, start over with whatever is hot from now on
+        log_info("JIT code buffer full after {} blocks, clearing it", m_jit.get_block_count());
+        m_jit.clear();
+        m_blockCache.clear_jit();
+        block.m_runs = Jit::HOT_RUNS;
+        block.m_jitFn = m_jit.compile(block);
+    }
+}
+
+// the native code runs FastPolicy blocks and has done what begin_block_instr does for the
+// instruction at m_blockPC. It hands the handler's result over in a register
+static_assert(std::is_trivially_copyable_v<InstructionResult> && sizeof(InstructionResult) == 8);
+CompiledStep Emulator::end_jit_instr(Emulator& emu, InstructionResult result, int64_t untilCycle,
+                                     uint32_t size) {
+    const auto pc = emu.m_blockPC;
+    const auto canContinue = emu.end_block_instr<FastPolicy>(pc, result, untilCycle);
+    emu.next_block_instr(uint16_t(pc + size));
+    if (!canContinue) {
+        return CompiledStep::STOP;
+    }
+    if (!emu.m_block) {
+        return CompiledStep::JUMPED;
+    }
+    // the handler may have scheduled an event
+    emu.m_jitSyncCycle = emu.get_next_sync_cycle(untilCycle);
+    return CompiledStep::NEXT;
+}
+
+void Emulator::sync_jit_flags(Emulator& emu) {
+    emu.sync_flags();
+}
+
+Jit::Layout Emulator::get_jit_layout() const {
+    // offsetof isn't defined for classes like this one
+    const auto* const base = reinterpret_cast<const uint8_t*>(this);
+    const auto offset = [base](const void* member) {
+        return int32_t(static_cast<const uint8_t*>(member) - base);
+    };
+    auto layout = Jit::Layout{};
+    layout.m_r8 = {offset(&m_reg.b), offset(&m_reg.c), offset(&m_reg.d), offset(&m_reg.e),
+                   offset(&m_reg.h), offset(&m_reg.l), -1,                offset(&m_reg.a)};
+    layout.m_r16 = {offset(&m_reg.bc), offset(&m_reg.de), offset(&m_reg.hl), offset(&m_reg.sp)};
+    layout.m_pc = offset(&m_reg.pc);
+    layout.m_f = offset(&m_reg.f);
+    layout.m_flagOp = offset(&m_lazyFlags.m_op);
+    layout.m_prefix = offset(&m_prefix);
+    layout.m_cpuCycle = offset(&m_cpuCycle);
+    layout.m_lastCpuCycle = offset(&m_lastCpuCycle);
+    layout.m_syncCycle = offset(&m_jitSyncCycle);
+    layout.m_instructionCounter = offset(&m_instructionCounter);
+    layout.m_idleLoopStart = offset(&m_idleLoop.m_start);
+    layout.m_idleLoopEnd = offset(&m_idleLoop.m_end);
+    layout.m_idleLoopBranchCycles = offset(&m_idleLoop.m_branchCycles);
+    layout.m_idleLoopCycle = offset(&m_idleLoop.m_cycle);
+    layout.m_block = offset(&m_block);
+    layout.m_blockIndex = offset(&m_blockIndex);
+    layout.m_blockPC = offset(&m_blockPC);
+    layout.m_syncFlags = &Emulator::sync_jit_flags;
+    return layout;
 }
 
-void Emulator::tick_countdowns() {
+template <typename TPolicy>
+uint16_t Emulator::begin_block_instr() {
+    m_lastCpuCycle = m_cpuCycle;
+    m_slowWrite = false;
+    if constexpr (TPolicy::LOGGING) {
+        maybe_log_registers();
+    }
+    m_prefix = false;
+    return m_reg.pc;
+}
+
+template <typename TPolicy>
+bool Emulator::end_block_instr(uint16_t pc, const InstructionResult& result, int64_t untilCycle) {
+    if (!m_haltBugTriggered) {
+        m_reg.pc = result.m_newPC;
+    } else {
+        log_warn("Halt bug triggered, skipping PC increment");
+    }
+    m_haltBugTriggered = false;
+    track_idle_loop(pc, m_reg.pc, result.m_cycles);
+    ++m_instructionCounter;
+    m_cpuCycle += result.m_cycles;
+
+    // Between two instructions the run_for loop fires events, catches the PPU up and checks for
+    // interrupts. Until the next event or PPU change none of that does anything, unless the
+    // instruction wrote IF, IE or some other register through the slow path, so the next
+    // instruction can run straight away on the same cycle it otherwise would have
+    if (m_slowWrite || m_haltMode || m_stopMode || (TPolicy::LOGGING && m_settings.m_logEnable) ||
+        m_reg.pc == m_idleLoop.m_start || m_cpuCycle >= get_next_sync_cycle(untilCycle)) {
+        return false;
+    }
+    return true;
+}
+
+// run_compiled_instr is called from the generated translation unit
+template uint16_t Emulator::begin_block_instr<FastPolicy>();
+template bool Emulator::end_block_instr<FastPolicy>(uint16_t, const InstructionResult&, int64_t);
+
+template <typename TPolicy>
+Block Emulator::decode_block(uint16_t pc, const uint8_t* code) {
+    // pcData is read 4 bytes at a time like read_pc_data does, and mustn't run off the page
+    const auto bytes = PAGE_SIZE - int(sizeof(uint32_t)) - pc % PAGE_SIZE;
+    const auto read_pc_data_at = [&](int offset) {
+        uint32_t pcData = 0;
+        memcpy(&pcData, code + offset, sizeof(pcData));
+        return pcData;
+    };
+
+    auto block = Block{};
+    block.m_pc = pc;
+    auto offset = 0;
+    while (offset <= bytes && int(block.m_instrs.size()) < Block::MAX_INSTRS) {
+        const auto pcData = read_pc_data_at(offset);
+        const auto op = OpCode(pcData & 0xFF);
+        if (op == OpCode::PREFIX) {
+            // nothing can run between the two halves, they have to be in the same block
+            if (offset + 1 > bytes || int(block.m_instrs.size()) + 2 > Block::MAX_INSTRS) {
+                break;
+            }
+            const auto cbData = read_pc_data_at(offset + 1);
+            block.m_instrs.push_back({s_opTable<TPolicy>[+op], pcData, 1, false});
+            block.m_instrs.push_back(
+                {s_opTablePrefixed<TPolicy>[cbData & 0xFF], cbData, 1, true});
+            offset += 2;
+            continue;
+        }
 
-    m_cyclesToWait = std::max(m_cyclesToWait - 1, 0);
-    m_oamDmaCyclesRemaining = std::max(m_oamDmaCyclesRemaining - 1, 0);
+        const auto size = OPCODE_TIMINGS[+op].m_size;
+        block.m_instrs.push_back({s_opTable<TPolicy>[+op], pcData, size, false});
+        offset += size;
 
-    if (m_pendingInterruptEnableCycleCount > 0) {
-        --m_pendingInterruptEnableCycleCount;
-        if (m_pendingInterruptEnableCycleCount == 0) {
-            // ez_assert(m_sysclk % 4 == 0);
-            m_interruptMasterEnable = true;
+        if (Block::ends_after(+op)) {
+            break;
         }
     }
+    return block;
+}
 
-    if (m_pendingTimaOverflowCycles >= 0) {
-        --m_pendingTimaOverflowCycles;
-        if (m_pendingTimaOverflowCycles == 0) {
-            // ez_assert((m_sysclk) % 4 == 0);
-            m_ioReg->m_if.timer = true;
-            m_ioReg->m_tima = m_ioReg->m_tma;
+const uint8_t* Emulator::get_code_ptr(uint16_t pc) const {
+    // cart RAM and VRAM hardly ever hold code and aren't write protected
+    if (pc < Cart::ROM_RANGE.m_max ||
+        (pc >= WRAM0_ADDR_RANGE.m_min && pc < WRAM1_ADDR_RANGE.m_max)) {
+        const auto page = m_readPages[pc / PAGE_SIZE];
+        return page ? page + pc % PAGE_SIZE : nullptr;
+    }
+    if (HRAM_ADDR_RANGE.containsExclusive(pc)) {
+        return &m_ioReg[pc];
+    }
+    return nullptr;
+}
+
+int64_t Emulator::get_next_sync_cycle(int64_t untilCycle) {
+    // PPU events run on the cycle after them, see run_for
+    const auto ppuCycle =
+        m_ppuEventCycle == Scheduler::NEVER ? Scheduler::NEVER : m_ppuEventCycle + 1;
+    return std::min({untilCycle, m_scheduler.next_cycle(), ppuCycle});
+}
+
+void Emulator::clear_blocks() {
+    for (int ramPage = 0; ramPage < int(m_ramCodePages.size()); ++ramPage) {
+        if (m_ramCodePages[ramPage]) {
+            protect_ram_page(ramPage, false);
         }
     }
+    m_blockCache.clear();
+    m_jit.clear();
+    m_block = nullptr;
+    m_hramCode = false;
 }
 
-void Emulator::tick_timers() {
+void Emulator::protect_ram_page(int ramPage, bool writeProtect) {
+    auto* const page = m_ram.data() + ramPage * PAGE_SIZE;
+    if (!writeProtect) {
+        m_blockCache.invalidate(page, page + PAGE_SIZE);
+        m_block = nullptr;
+    }
+    m_ramCodePages[ramPage] = writeProtect;
+    // the page and its echo
+    for (const auto& range : {iRange{WRAM0_ADDR_RANGE.m_min, WRAM1_ADDR_RANGE.m_max},
+                              MIRROR_ADDR_RANGE}) {
+        const auto addr = range.m_min + ramPage * PAGE_SIZE;
+        if (range.containsExclusive(addr)) {
+            m_writePages[addr / PAGE_SIZE] = writeProtect ? nullptr : page;
+        }
+    }
+}
 
-    auto sysclkBefore = m_sysclk;
-    ++m_sysclk;
+int64_t Emulator::get_next_interrupt_cycle() const {
+    auto cycle = Scheduler::NEVER;
+    const auto& ie = m_ioReg->m_ie;
+    if (ie.timer) {
+        cycle = get_tima_overflow_cycle();
+    }
+    // PPU events run on the cycle after them, see run_for
+    if (ie.lcd) {
+        // any mode change or LY increment might raise STAT
+        if (m_ppuEventCycle != Scheduler::NEVER) {
+            cycle = std::min(cycle, m_ppuEventCycle + 1);
+        }
+    } else if (ie.vblank) {
+        const auto dots = m_ppu.get_dots_until_vblank();
+        if (dots != std::numeric_limits<int>::max()) {
+            cycle = std::min(cycle, m_ppuCycle + dots);
+        }
+    }
+    // serial transfers complete instantly and never raise an IRQ, joypad input only changes
+    // between calls to run_for
+    return cycle;
+}
+
+int64_t Emulator::get_tima_overflow_cycle() const {
+    if (m_scheduler.is_scheduled(EventType::TIMA_RELOAD)) {
+        return m_scheduler.get_cycle(EventType::TIMA_RELOAD);
+    }
+    // the reload (and IRQ) follows an M-cycle later
+    return m_scheduler.get_cycle(EventType::TIMA_OVERFLOW);
+}
 
-    m_ioReg->m_timerDivider = m_sysclk >> 8;
+bool Emulator::try_skip_idle_loop(int64_t untilCycle) {
+    auto& loop = m_idleLoop;
+    // a trace or profile has to count every instruction that ran, polling loops most of all
+    if (!m_settings.m_skipIdleLoops || m_settings.m_logEnable || m_trace || m_profiling) {
+        loop.m_start = -1;
+        return false;
+    }
 
-    if (is_tima_increment(sysclkBefore, m_sysclk, m_ioReg->m_tac, m_ioReg->m_tac)) {
+    const auto timedReadsUnchanged = [&] {
+        for (int i = 0; i < loop.m_numTimedReads; ++i) {
+            const auto [addr, val] = loop.m_timedReads[i];
+            if (m_ioReg[addr] != val) {
+                return false;
+            }
+        }
+        return true;
+    };
+    // F alone can be stale while a flag op is pending, two arrivals could look the same when the
+    // flags the loop branches on differ
+    sync_flags();
+    const auto repeating = loop.m_cycle >= 0 && loop.m_pure && !m_prefix &&
+                           loop.m_ime == m_interruptMasterEnable &&
+                           memcmp(&loop.m_reg, &m_reg, sizeof(Reg)) == 0 && timedReadsUnchanged();
+    if (repeating) {
+        const auto period = m_cpuCycle - loop.m_cycle;
+        const auto wakeCycle = std::min(get_next_idle_loop_change_cycle(), untilCycle);
+        const auto iterations = std::max<int64_t>(wakeCycle - m_cpuCycle, 0) / period;
+        if (iterations > 0) {
+            const auto skipped = iterations * period;
+            m_instructionCounter += iterations * (m_instructionCounter - loop.m_instructionCounter);
+            m_lastCpuCycle = m_cpuCycle + skipped - loop.m_branchCycles;
+            m_cpuCycle += skipped;
+            ++m_idleLoopHits;
+            m_idleLoopSkippedCycles += skipped;
+            loop.m_cycle += skipped;
+            loop.m_instructionCounter = m_instructionCounter;
+            return true;
+        }
+    }
+
+    // watch the next iteration
+    loop.m_reg = m_reg;
+    loop.m_ime = m_interruptMasterEnable;
+    loop.m_cycle = m_cpuCycle;
+    loop.m_instructionCounter = m_instructionCounter;
+    loop.m_pure = true;
+    loop.m_readsDiv = false;
+    loop.m_numTimedReads = 0;
+    return false;
+}
+
+void Emulator::track_idle_loop(uint16_t pc, uint16_t newPC, int cycles) {
+    auto& loop = m_idleLoop;
+    if (loop.m_start >= 0 && (pc < loop.m_start || pc > loop.m_end)) {
+        loop.m_start = -1; // left the loop
+    }
+    if (newPC < pc && pc - newPC <= IdleLoop::MAX_LOOP_BYTES && newPC != loop.m_start) {
+        loop.m_start = newPC;
+        loop.m_end = pc;
+        loop.m_cycle = -1;
+    }
+    if (pc == loop.m_end) {
+        loop.m_branchCycles = cycles;
+    }
+}
+
+void Emulator::note_idle_loop_read(uint16_t addr, uint8_t val) const {
+    auto& loop = m_idleLoop;
+    if (loop.m_start < 0 || !loop.m_pure) {
+        return;
+    }
+    switch (addr) {
+        case +IOAddr::DIV:  loop.m_readsDiv = true; [[fallthrough]];
+        case +IOAddr::LY:   [[fallthrough]];
+        case +IOAddr::STAT: [[fallthrough]];
+        case +IOAddr::IF:   break;
+        case +IOAddr::LYC:  [[fallthrough]];
+        case +IOAddr::IE:   return;
+        default:
+            // ROM and HRAM only change on a CPU write, which already ends the loop
+            loop.m_pure = addr < Cart::ROM_RANGE.m_max || HRAM_ADDR_RANGE.containsExclusive(addr);
+            return;
+    }
+    for (int i = 0; i < loop.m_numTimedReads; ++i) {
+        if (loop.m_timedReads[i].first == addr) {
+            // changed mid-iteration
+            loop.m_pure = loop.m_timedReads[i].second == val;
+            return;
+        }
+    }
+    if (loop.m_numTimedReads == IdleLoop::MAX_TIMED_READS) {
+        loop.m_pure = false;
+        return;
+    }
+    loop.m_timedReads[loop.m_numTimedReads++] = {addr, val};
+}
+
+int64_t Emulator::get_next_idle_loop_change_cycle() const {
+    // anything that could set IF, enable interrupts or change a timed register
+    auto cycle = std::min({m_scheduler.get_cycle(EventType::IME_ENABLE),
+                           m_scheduler.get_cycle(EventType::OAM_DMA_END),
+                           get_tima_overflow_cycle()});
+    // PPU events run on the cycle after them, see run_for
+    if (m_ppuEventCycle != Scheduler::NEVER) {
+        cycle = std::min(cycle, m_ppuEventCycle + 1);
+    }
+    if (m_idleLoop.m_readsDiv) {
+        // the cycle whose system clock tick carries into DIV
+        const auto sysclk = get_sysclk(m_cpuCycle + 1);
+        cycle = std::min(cycle, m_cpuCycle + (0x100 - (sysclk & 0xFF)));
+    }
+    return cycle;
+}
+
+void Emulator::sync_timers(int64_t cycle) {
+    while (const auto event = m_scheduler.pop_due(cycle)) {
+        handle_event(*event);
+    }
+}
+
+void Emulator::sync_ppu(int64_t cycle) {
+    if (cycle < m_ppuCycle) {
+        return;
+    }
+    sync_oam_dma(cycle);
+    m_ppu.tick_for(checked_cast<int>(cycle + 1 - m_ppuCycle));
+    m_ppuCycle = cycle + 1;
+    update_ppu_event_cycle();
+    if (m_ppu.is_vram_avail_to_cpu() != m_vramMapped) {
+        map_vram_pages();
+    }
+}
+
+void Emulator::update_ppu_event_cycle() {
+    const auto dots = m_ppu.get_dots_until_next_event();
+    m_ppuEventCycle =
+        dots == std::numeric_limits<int>::max() ? Scheduler::NEVER : m_ppuCycle + dots - 1;
+}
+
+void Emulator::sync_apu(int64_t cycle) const {
+    if (cycle < m_apuCycle) {
+        return;
+    }
+    m_apu.tick_for(checked_cast<int>(cycle + 1 - m_apuCycle));
+    m_apuCycle = cycle + 1;
+}
+
+void Emulator::handle_event(const Event& event) {
+    switch (event.m_type) {
+        case EventType::IME_ENABLE: m_interruptMasterEnable = true; break;
+        case EventType::TIMA_RELOAD:
+            m_ioReg->m_if.request(Interrupts::TIMER);
+            // an increment on this cycle lands on top of TMA
+            sync_tima(event.m_cycle);
+            m_ioReg->m_tima = m_ioReg->m_tma;
+            schedule_tima_overflow();
+            break;
+        case EventType::OAM_DMA_END:
+            sync_oam_dma(event.m_cycle);
+            m_oamDmaActive = false;
+            map_pages();
+            break;
+        case EventType::TIMA_OVERFLOW:
+            sync_tima(event.m_cycle + 1);
+            ez_assert(m_ioReg->m_tima == 0);
+            m_scheduler.schedule(EventType::TIMA_RELOAD, event.m_cycle + T_CYCLES_PER_M_CYCLE + 1);
+            schedule_tima_overflow();
+            break;
+        default: fail("not implemented");
+    }
+}
+
+uint8_t Emulator::get_tima(int64_t cycle) const {
+    ez_assert(cycle >= m_timaCycle);
+    const auto tac = m_ioReg->m_tac;
+    if (!(tac & 0b100)) {
+        return m_ioReg->m_tima;
+    }
+    // TIMA increments when the selected bit falls, ie. every time the bits below it wrap to 0. It
+    // wraps at most once here, TIMA_OVERFLOW syncs it then
+    const auto period = get_tima_period(tac);
+    const auto increments =
+        (cycle - m_sysclkOrigin) / period - (m_timaCycle - m_sysclkOrigin) / period;
+    ez_assert(increments <= 0x100 - m_ioReg->m_tima);
+    return uint8_t(m_ioReg->m_tima + increments);
+}
+
+void Emulator::sync_tima(int64_t cycle) {
+    m_ioReg->m_tima = get_tima(cycle);
+    m_timaCycle = cycle;
+}
+
+void Emulator::reset_div() {
+    const auto sysclk = get_sysclk(m_cpuCycle + 1);
+    sync_tima(m_cpuCycle + 1);
+    m_ioReg->m_timerDivider = 0;
+    if (is_tima_increment(sysclk, 0, m_ioReg->m_tac, m_ioReg->m_tac)) {
+        log_warn("TIMA incr from div reset");
         ++m_ioReg->m_tima;
         if (m_ioReg->m_tima == 0) {
-            m_pendingTimaOverflowCycles = T_CYCLES_PER_M_CYCLE + 1;
+            m_scheduler.schedule(EventType::TIMA_RELOAD, m_cpuCycle + T_CYCLES_PER_M_CYCLE);
         }
     }
+    m_sysclkOrigin = m_cpuCycle + 1;
+    schedule_tima_overflow();
 }
 
-void Emulator::tick_interrupts() {
+void Emulator::schedule_tima_overflow() {
+    const auto tac = m_ioReg->m_tac;
+    if (!(tac & 0b100)) {
+        m_scheduler.cancel(EventType::TIMA_OVERFLOW);
+        return;
+    }
+    const auto period = get_tima_period(tac);
+    const auto increments = 0x100 - m_ioReg->m_tima;
+    const auto overflowCycle =
+        m_sysclkOrigin + ((m_timaCycle - m_sysclkOrigin) / period + increments) * period;
+    m_scheduler.schedule(EventType::TIMA_OVERFLOW, overflowCycle - 1);
+}
 
-    for (auto i = 0; i < +Interrupts::NUM_INTERRUPTS; ++i) {
-        const uint8_t bitFlag = 0b1 << i;
-        if (m_ioReg[+IOAddr::IF] & bitFlag && m_ioReg[+IOAddr::IE] & bitFlag) {
-            // todo, implement halt bug
-            m_haltMode = false;
-            if (m_interruptMasterEnable) {
-                if (m_settings.m_logEnable) {
-                    log_info("Calling ISR {}", i);
-                }
-                m_ioReg[+IOAddr::IF] &= ~bitFlag;
-                m_interruptMasterEnable = false;
-                m_reg.sp -= 2;
-                write_addr_16(m_reg.sp, m_reg.pc);
-                ez_assert(m_cyclesToWait == 0);
-                m_cyclesToWait = 20; // 5 m-cycles
-                switch (i) {
-                    case +Interrupts::VBLANK: m_reg.pc = 0x40; break;
-                    case +Interrupts::JOYPAD: m_reg.pc = 0x60; break;
-                    case +Interrupts::SERIAL: m_reg.pc = 0x58; break;
-                    case +Interrupts::LCD:    m_reg.pc = 0x48; break;
-                    case +Interrupts::TIMER:  m_reg.pc = 0x50; break;
-                    default:                  fail("Should never get here");
-                }
-                // only one interrupt serviced per tick
-                break;
-            } else {
-                if (m_isInstructionAfterHaltMode) {
-                    m_haltBugTriggered = true;
-                    log_warn("Halt bug triggered!");
-                }
-            }
+bool Emulator::dispatch_interrupts() {
+    const auto afterHalt = m_isInstructionAfterHaltMode;
+    m_isInstructionAfterHaltMode = false;
+    // nearly always nothing is pending
+    const auto pending = uint8_t(m_ioReg->m_if.get_mask() & m_ioReg->m_ie.get_mask());
+    if (pending == 0) {
+        return false;
+    }
+
+    // todo, implement halt bug
+    m_haltMode = false;
+    if (!m_interruptMasterEnable) {
+        if (afterHalt) {
+            m_haltBugTriggered = true;
+            log_warn("Halt bug triggered!");
         }
+        return false;
     }
-    m_isInstructionAfterHaltMode = false;
+
+    // only one interrupt serviced per step, the lowest bit has the highest priority
+    const auto interrupt = Interrupts(std::countr_zero(pending));
+    if (m_settings.m_logEnable) {
+        log_verbose("Calling ISR {}", +interrupt);
+    }
+    m_ioReg->m_if.acknowledge(interrupt);
+    m_interruptMasterEnable = false;
+    m_reg.sp -= 2;
+    write_addr_16(m_reg.sp, m_reg.pc);
+    m_reg.pc = uint16_t(0x40 + 8 * +interrupt);
+    return true;
 }
 
 AddrInfo Emulator::get_addr_info(uint16_t addr) const {
@@ -989,27 +1525,67 @@ AddrInfo Emulator::get_addr_info(uint16_t addr) const {
     }
 }
 
+template <typename TPolicy>
 void Emulator::write_addr(uint16_t addr, uint8_t data) {
+    if constexpr (TPolicy::TRACK_WRITES) {
+        m_lastWrittenAddr = addr;
+    }
+    m_idleLoop.m_pure = false;
+    if (const auto page = m_writePages[addr / PAGE_SIZE]) {
+        page[addr % PAGE_SIZE] = data;
+    } else {
+        write_addr_slow(addr, data);
+    }
+}
+
+void Emulator::write_addr_slow(uint16_t addr, uint8_t data) {
+    m_slowWrite = true;
+    if (m_oamDmaActive && addr < IO_ADDR_RANGE.m_min) {
+        return; // the DMA has the bus
+    }
     if (addr == +IOAddr::TAC) {
         log_warn("TAC set to {}", data);
     }
     if (addr == +IOAddr::TIMA) {
         log_warn("TIMA set to {}", data);
     }
-    m_lastWrittenAddr = addr;
     const auto addrInfo = get_addr_info(addr);
     switch (addrInfo.m_bank) {
-        case MemoryBank::ROM:     m_cart.write_addr(addr, data); break;
+        case MemoryBank::ROM:
+            m_cart.write_addr(addr, data);
+            map_cart_pages(); // MBC register write, might have switched banks
+            break;
         case MemoryBank::EXT_RAM: m_cart.write_addr(addr, data); break;
         case MemoryBank::WRAM_0:  [[fallthrough]];
-        case MemoryBank::WRAM_1:  m_ram[addr - addrInfo.m_baseAddr] = data; break;
-        case MemoryBank::MIRROR:  m_ram[addr - addrInfo.m_baseAddr] = data; break;
-        case MemoryBank::VRAM:    m_ppu.write_addr(addr, data); break;
-        case MemoryBank::OAM:     m_ppu.write_addr(addr, data); break;
+        case MemoryBank::WRAM_1:  [[fallthrough]];
+        case MemoryBank::MIRROR:  {
+            // only pages holding cached code come through here
+            const auto offset = addr - addrInfo.m_baseAddr;
+            if (m_ramCodePages[offset / PAGE_SIZE]) {
+                protect_ram_page(offset / PAGE_SIZE, false);
+            }
+            m_ram[offset] = data;
+            break;
+        }
+        case MemoryBank::VRAM:    [[fallthrough]];
+        case MemoryBank::OAM:
+            sync_ppu(m_cpuCycle - 1);
+            m_ppu.write_addr(addr, data);
+            break;
         case MemoryBank::IO:
             if (APU::AUDIO_ADDR_RANGE.containsExclusive(addr)) {
+                sync_apu(m_cpuCycle - 1);
                 m_apu.write_addr(addr, data);
             } else {
+                if (PPU::LCD_IO_ADDR_RANGE.containsExclusive(addr)) {
+                    sync_ppu(m_cpuCycle - 1);
+                }
+                if (m_hramCode && HRAM_ADDR_RANGE.containsExclusive(addr)) {
+                    const auto hram = &m_ioReg[HRAM_ADDR_RANGE.m_min];
+                    m_blockCache.invalidate(hram, hram + HRAM_ADDR_RANGE.width());
+                    m_block = nullptr;
+                    m_hramCode = false;
+                }
                 write_io(addr, data);
             }
             break;
@@ -1018,14 +1594,28 @@ void Emulator::write_addr(uint16_t addr, uint8_t data) {
     }
 }
 
+template <typename TPolicy>
 void Emulator::write_addr_16(uint16_t addr, uint16_t data) {
-    m_lastWrittenAddr = addr;
-    write_addr(addr, uint8_t(data & 0x00FF));
-    write_addr(addr + 1, uint8_t(data >> 8));
+    write_addr<TPolicy>(addr, uint8_t(data & 0x00FF));
+    write_addr<TPolicy>(addr + 1, uint8_t(data >> 8));
 }
 
+template void Emulator::write_addr<DebugPolicy>(uint16_t, uint8_t);
+template void Emulator::write_addr_16<DebugPolicy>(uint16_t, uint16_t);
+
 uint8_t Emulator::read_addr(uint16_t addr) const {
+    if (const auto page = m_readPages[addr / PAGE_SIZE]) {
+        return page[addr % PAGE_SIZE];
+    }
+    const auto val = read_addr_slow(addr);
+    note_idle_loop_read(addr, val);
+    return val;
+}
 
+uint8_t Emulator::read_addr_slow(uint16_t addr) const {
+    if (m_oamDmaActive && addr < IO_ADDR_RANGE.m_min) {
+        return 0xFF; // the DMA has the bus
+    }
     const auto addrInfo = get_addr_info(addr);
     switch (addrInfo.m_bank) {
         case MemoryBank::ROM:
@@ -1040,7 +1630,9 @@ uint8_t Emulator::read_addr(uint16_t addr) const {
         case MemoryBank::VRAM:    return m_ppu.read_addr(addr);
         case MemoryBank::OAM:     return m_ppu.read_addr(addr);
         case MemoryBank::IO:
+            // PPU reads don't need a sync, what they return only changes on a PPU event
             if (APU::AUDIO_ADDR_RANGE.containsExclusive(addr)) {
+                sync_apu(m_cpuCycle - 1);
                 return m_apu.read_addr(addr);
             } else {
                 return read_io(addr);
@@ -1058,44 +1650,38 @@ void Emulator::write_io(uint16_t addr, uint8_t val) {
             m_ioReg->m_serialData = val;
             return;
         case +IOAddr::DIV: {
-            m_ioReg->m_timerDivider = 0;
-            if (is_tima_increment(m_sysclk, 0, m_ioReg->m_tac, m_ioReg->m_tac)) {
-                log_warn("TIMA incr from div write");
-                ++m_ioReg->m_tima;
-                if (m_ioReg->m_tima == 0) {
-                    m_pendingTimaOverflowCycles = T_CYCLES_PER_M_CYCLE;
-                }
-            }
-            m_sysclk = 0;
+            reset_div();
             return;
         }
-        case +IOAddr::TAC:
-            if (is_tima_increment(m_sysclk, m_sysclk, m_ioReg->m_tac, val)) {
+        case +IOAddr::TAC: {
+            const auto sysclk = get_sysclk(m_cpuCycle + 1);
+            sync_tima(m_cpuCycle + 1);
+            if (is_tima_increment(sysclk, sysclk, m_ioReg->m_tac, val)) {
                 log_warn("TIMA incr from TAC write");
                 ++m_ioReg->m_tima;
                 if (m_ioReg->m_tima == 0) {
-                    m_pendingTimaOverflowCycles = T_CYCLES_PER_M_CYCLE;
+                    m_scheduler.schedule(EventType::TIMA_RELOAD,
+                                         m_cpuCycle + T_CYCLES_PER_M_CYCLE);
                 }
             }
             m_ioReg->m_tac = val;
+            schedule_tima_overflow();
             return;
+        }
         case +IOAddr::TIMA: {
+            sync_tima(m_cpuCycle + 1);
             m_ioReg->m_tima = val;
             // todo, verify overwriting value with modulo if same cycle
-            if (m_pendingTimaOverflowCycles == T_CYCLES_PER_M_CYCLE) {
+            if (m_scheduler.get_cycle(EventType::TIMA_RELOAD) ==
+                m_cpuCycle + T_CYCLES_PER_M_CYCLE) {
                 log_warn("TIMA written to on overflow tick");
-                m_pendingTimaOverflowCycles = 0;
+                m_scheduler.cancel(EventType::TIMA_RELOAD);
             }
+            schedule_tima_overflow();
             return;
         }
         case +IOAddr::DMA: {
-            m_oamDmaCyclesRemaining = 160 * T_CYCLES_PER_M_CYCLE;
-            const uint16_t srcAddr = uint16_t(val) << 8;
-            const uint16_t dstAddr = uint16_t(PPU::OAM_ADDR_RANGE.m_min);
-            // todo, dont' do the copy instantaneously
-            for (auto offset = 0; offset < PPU::OAM_ADDR_RANGE.width(); ++offset) {
-                write_addr(dstAddr + uint16_t(offset), read_addr(srcAddr + uint16_t(offset)));
-            }
+            start_oam_dma(val);
             m_ioReg->m_lcd.m_dma = val;
             break;
         }
@@ -1114,6 +1700,20 @@ void Emulator::write_io(uint16_t addr, uint8_t val) {
             if (!m_ioReg->m_lcd.m_control.m_ppuEnable) {
                 m_ppu.reset();
             }
+            update_ppu_event_cycle();
+            map_vram_pages();
+            break;
+        }
+        case +IOAddr::BANK: {
+            m_ioReg[+IOAddr::BANK] = val;
+            map_cart_pages();
+            break;
+        }
+        case +IOAddr::BGP:
+        case +IOAddr::OBP0:
+        case +IOAddr::OBP1: {
+            m_ioReg[addr] = val;
+            m_ppu.update_palettes();
             break;
         }
         default: {
@@ -1129,37 +1729,202 @@ uint16_t Emulator::readAddr16(uint16_t addr) const {
     return uint16_t(byte1) << 8 | uint16_t(byte0);
 }
 
-void Emulator::maybe_log_opcode(const OpCodeInfo& info) const {
+uint32_t Emulator::read_pc_data() const {
+    const auto offset = m_reg.pc % PAGE_SIZE;
+    const auto page = m_readPages[m_reg.pc / PAGE_SIZE];
+    if constexpr (std::endian::native == std::endian::little) {
+        if (page && offset <= PAGE_SIZE - int(sizeof(uint32_t))) {
+            uint32_t pcData = 0;
+            memcpy(&pcData, page + offset, sizeof(pcData));
+            return pcData;
+        }
+    }
+    const auto word0 = readAddr16(m_reg.pc);
+    const auto word1 = readAddr16(m_reg.pc + 2);
+    return (uint32_t(word1) << 16) | (uint32_t(word0));
+}
+
+void Emulator::map_pages() {
+    m_readPages.fill(nullptr);
+    m_writePages.fill(nullptr);
+
+    for (auto addr = WRAM0_ADDR_RANGE.m_min; addr < WRAM1_ADDR_RANGE.m_max; addr += PAGE_SIZE) {
+        m_readPages[addr / PAGE_SIZE] = m_ram.data() + (addr - WRAM0_ADDR_RANGE.m_min);
+        m_writePages[addr / PAGE_SIZE] = m_ram.data() + (addr - WRAM0_ADDR_RANGE.m_min);
+    }
+    for (auto addr = MIRROR_ADDR_RANGE.m_min; addr < MIRROR_ADDR_RANGE.m_max; addr += PAGE_SIZE) {
+        m_readPages[addr / PAGE_SIZE] = m_ram.data() + (addr - MIRROR_ADDR_RANGE.m_min);
+        m_writePages[addr / PAGE_SIZE] = m_ram.data() + (addr - MIRROR_ADDR_RANGE.m_min);
+    }
+    // OAM, the unusable zone, IO and HRAM all share the last two pages and always take the slow path
+
+    map_cart_pages();
+    map_vram_pages();
+    for (auto page = 0; page < int(m_ramCodePages.size()); ++page) {
+        if (m_ramCodePages[page]) {
+            protect_ram_page(page, true);
+        }
+    }
+}
+
+void Emulator::map_cart_pages() {
+    m_block = nullptr; // same PC, different code
+    for (auto addr = Cart::ROM_RANGE.m_min; addr < Cart::ROM_RANGE.m_max; addr += PAGE_SIZE) {
+        m_readPages[addr / PAGE_SIZE] = m_cart.get_read_ptr(uint16_t(addr));
+        m_writePages[addr / PAGE_SIZE] = m_cart.get_write_ptr(uint16_t(addr));
+    }
+    for (auto addr = Cart::RAM_RANGE.m_min; addr < Cart::RAM_RANGE.m_max; addr += PAGE_SIZE) {
+        m_readPages[addr / PAGE_SIZE] = m_cart.get_read_ptr(uint16_t(addr));
+        m_writePages[addr / PAGE_SIZE] = m_cart.get_write_ptr(uint16_t(addr));
+    }
+    static_assert(BOOTROM_BYTES == PAGE_SIZE);
+    if (!m_ioReg->m_bootromDisabled) {
+        m_readPages[0] = m_bootrom.data();
+    }
+}
+
+void Emulator::map_vram_pages() {
+    m_vramMapped = m_ppu.is_vram_avail_to_cpu();
+    const auto& range = PPU::VRAM_ADDR_RANGE;
+    const auto mapped = m_vramMapped && !m_oamDmaActive;
+    for (auto addr = range.m_min; addr < range.m_max; addr += PAGE_SIZE) {
+        // tile data writes go through the PPU, it keeps them decoded
+        const auto tileData = PPU::TILE_DATA_ADDR_RANGE.containsExclusive(addr);
+        m_readPages[addr / PAGE_SIZE] = mapped ? m_ppu.get_vram_ptr(uint16_t(addr)) : nullptr;
+        m_writePages[addr / PAGE_SIZE] =
+            mapped && !tileData ? m_ppu.get_tile_map_ptr(uint16_t(addr)) : nullptr;
+    }
+}
+
+void Emulator::start_oam_dma(uint8_t srcPage) {
+    sync_oam_dma(m_cpuCycle); // restarting cuts the previous transfer short
+
+    // E000-FFFF reads WRAM, like the echo
+    auto src = uint16_t(srcPage << 8);
+    if (src >= MIRROR_ADDR_RANGE.m_min) {
+        src -= uint16_t(MIRROR_ADDR_RANGE.m_min - WRAM0_ADDR_RANGE.m_min);
+    }
+    const uint8_t* srcPtr = nullptr;
+    if (src < BOOTROM_BYTES && !m_ioReg->m_bootromDisabled) {
+        srcPtr = m_bootrom.data();
+    } else if (PPU::VRAM_ADDR_RANGE.containsExclusive(src)) {
+        srcPtr = m_ppu.get_vram_ptr(src);
+    } else if (src >= WRAM0_ADDR_RANGE.m_min) {
+        srcPtr = m_ram.data() + (src - WRAM0_ADDR_RANGE.m_min);
+    } else {
+        srcPtr = m_cart.get_read_ptr(src);
+    }
+    static_assert(OAM_DMA_BYTES <= PAGE_SIZE);
+    if (srcPtr) {
+        memcpy(m_oamDmaData.data(), srcPtr, OAM_DMA_BYTES);
+    } else { // disabled cart RAM or past the end of the ROM
+        for (auto offset = 0; offset < OAM_DMA_BYTES; ++offset) {
+            m_oamDmaData[offset] = m_cart.read_addr(uint16_t(src + offset));
+        }
+    }
+
+    // the first M-cycle after the write sets the transfer up
+    m_oamDmaStartCycle = m_cpuCycle + T_CYCLES_PER_M_CYCLE;
+    m_oamDmaBytesCopied = 0;
+    m_oamDmaActive = true;
+    m_scheduler.schedule(EventType::OAM_DMA_END,
+                         m_oamDmaStartCycle + OAM_DMA_BYTES * T_CYCLES_PER_M_CYCLE);
+    m_readPages.fill(nullptr);
+    m_writePages.fill(nullptr);
+    m_block = nullptr;
+}
+
+void Emulator::sync_oam_dma(int64_t cycle) {
+    if (m_oamDmaBytesCopied == OAM_DMA_BYTES || cycle < m_oamDmaStartCycle) {
+        return;
+    }
+    const auto due = int(std::min<int64_t>(
+        (cycle - m_oamDmaStartCycle) / T_CYCLES_PER_M_CYCLE + 1, OAM_DMA_BYTES));
+    if (due > m_oamDmaBytesCopied) {
+        memcpy(m_ppu.get_oam_ptr() + m_oamDmaBytesCopied,
+               m_oamDmaData.data() + m_oamDmaBytesCopied, size_t(due - m_oamDmaBytesCopied));
+        m_oamDmaBytesCopied = due;
+    }
+}
+
+void Emulator::maybe_log_opcode(uint8_t opByte, bool prefixed) const {
     if (m_settings.m_logEnable) {
-        log_info("{}", info);
+        log_verbose("{}", prefixed ? get_opcode_info_prefixed(opByte) : get_opcode_info(opByte));
+    }
+}
+
+bool Emulator::start_trace(const fs::path& path) {
+    m_trace = std::make_unique<TraceWriter>(path);
+    if (!m_trace->is_open()) {
+        m_trace.reset();
+        return false;
+    }
+    return true;
+}
+
+void Emulator::maybe_trace_instr(uint8_t opByte) {
+    if (!m_trace) {
+        return;
+    }
+    auto status = uint8_t(m_interruptMasterEnable ? +TraceStatus::IME : 0);
+    if (m_prefix) {
+        status |= +TraceStatus::PREFIXED;
+    }
+    m_trace->record({m_cpuCycle, m_reg.pc, uint16_t(m_cart.get_rom_bank()), opByte, status,
+                     read_R16Stack(R16Stack::AF), m_reg.bc, m_reg.de, m_reg.hl, m_reg.sp});
+}
+
+void Emulator::start_profiling() {
+    if (!m_profiler) {
+        m_profiler = std::make_unique<Profiler>(m_cart.get_rom().size());
+    } else {
+        m_profiler->reset();
+    }
+    m_profiling = true;
+}
+
+void Emulator::maybe_profile_instr(uint16_t pc, uint8_t opByte, bool prefixed, int cycles) {
+    if (!m_profiling) {
+        return;
+    }
+    // counted against the bank mapped after the instruction, which only differs for code that
+    // switches out its own bank
+    auto romOffset = std::optional<size_t>{};
+    if (Cart::ROM_RANGE.containsExclusive(pc) &&
+        (m_ioReg->m_bootromDisabled || pc >= BOOTROM_BYTES)) {
+        if (const auto ptr = m_cart.get_read_ptr(pc)) {
+            romOffset = size_t(ptr - m_cart.get_rom().data());
+        }
     }
+    m_profiler->record(romOffset, pc, opByte, prefixed, cycles);
 }
 
 void Emulator::maybe_log_registers() const {
     if (m_settings.m_logEnable) {
-        log_info("A {:#04x} B {:#04x} C {:#04x} D {:#04x} E {:#04x} F {:#04x} H {:#04x} L {:#04x}",
-                 m_reg.a,
-                 m_reg.b,
-                 m_reg.c,
-                 m_reg.d,
-                 m_reg.e,
-                 m_reg.f,
-                 m_reg.h,
-                 m_reg.l);
-
-        log_info("AF {:#06x} BC {:#06x} DE {:#06x} HL {:#06x} PC {:#06x} SP {:#06x} ",
-                 m_reg.af,
-                 m_reg.bc,
-                 m_reg.de,
-                 m_reg.hl,
-                 m_reg.pc,
-                 m_reg.sp);
-
-        log_info("Flags: Z {} N {} H {} C {}",
-                 get_flag(Flag::ZERO),
-                 get_flag(Flag::NEGATIVE),
-                 get_flag(Flag::HALF_CARRY),
-                 get_flag(Flag::CARRY));
+        log_verbose("A {:#04x} B {:#04x} C {:#04x} D {:#04x} "
+                    "E {:#04x} F {:#04x} H {:#04x} L {:#04x}",
+                    m_reg.a,
+                    m_reg.b,
+                    m_reg.c,
+                    m_reg.d,
+                    m_reg.e,
+                    get_f(),
+                    m_reg.h,
+                    m_reg.l);
+
+        log_verbose("AF {:#06x} BC {:#06x} DE {:#06x} HL {:#06x} PC {:#06x} SP {:#06x} ",
+                    read_R16Stack(R16Stack::AF),
+                    m_reg.bc,
+                    m_reg.de,
+                    m_reg.hl,
+                    m_reg.pc,
+                    m_reg.sp);
+
+        log_verbose("Flags: Z {} N {} H {} C {}",
+                    get_flag(Flag::ZERO),
+                    get_flag(Flag::NEGATIVE),
+                    get_flag(Flag::HALF_CARRY),
+                    get_flag(Flag::CARRY));
     }
 }
 
@@ -1204,6 +1969,8 @@ uint8_t Emulator::read_io(uint16_t addr) const {
             }
             return byte;
         }
+        case +IOAddr::DIV:  return uint8_t(get_sysclk(m_cpuCycle + 1) >> 8);
+        case +IOAddr::TIMA: return get_tima(m_cpuCycle + 1);
         default:
             EZ_ENSURE(IO_ADDR_RANGE.containsExclusive(addr));
             return m_ioReg[addr];
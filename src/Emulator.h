@@ -1,10 +1,17 @@
 #pragma once
 #include "APU.h"
 #include "Base.h"
+#include "BlockCache.h"
 #include "Cart.h"
 #include "IO.h"
+#include "MiscOps.h"
 #include "OpCodes.h"
 #include "PPU.h"
+#include "Recompiler.h"
+#include "Scheduler.h"
+#include "Profiler.h"
+#include "Trace.h"
+#include <unordered_map>
 
 namespace ez {
 
@@ -45,9 +52,34 @@ enum class Cond {
     C
 };
 
+enum class CpuDispatch {
+    SWITCH, // decode opcode bit fields at runtime
+    TABLE,  // jump through a table of per-opcode specialised handlers
+    CACHED, // TABLE handlers pre-decoded per block, run back to back while no event is due
+    JIT,    // CACHED, with hot blocks compiled to native code on x86-64 hosts, see Jit
+};
+
+// Compile time switches for the hooks only the debugger needs. The CPU is built once per policy,
+// the production build of the hot path has no logging or write tracking in it at all.
+// EmuSettings::m_debugHooks picks which one runs
+struct FastPolicy {
+    static constexpr bool LOGGING = false;      // opcode, register and branch logging
+    static constexpr bool TRACK_WRITES = false; // get_last_written_addr, for write breakpoints
+};
+struct DebugPolicy {
+    static constexpr bool LOGGING = true;
+    static constexpr bool TRACK_WRITES = true;
+};
+
 struct EmuSettings {
-    bool m_logEnable = false;
+    bool m_logEnable = false; // implies m_debugHooks
+    bool m_debugHooks = false; // run the DebugPolicy CPU, for breakpoints and logging
     bool m_skipBootROM = false;
+    CpuDispatch m_cpuDispatch = CpuDispatch::CACHED;
+    bool m_skipIdleLoops = true; // fast-forward loops polling LY/STAT/IF/DIV, off while logging, tracing or profiling
+    const CompiledRom* m_compiledRom = nullptr; // from ezgb_recompile, used by CACHED
+    DisplayFormat m_displayFormat = DisplayFormat::RGBA8; // INDEXED if nothing shows the frames
+    PPU::DisplayColors m_displayColors = PPU::DEFAULT_DISPLAY_COLORS; // kept over a reset
 };
 
 enum class MemoryBank {
@@ -119,6 +151,28 @@ enum class Flag {
     CARRY = 4
 };
 
+// 8-bit ALU operation whose flags haven't been written to F yet
+enum class FlagOp : uint8_t {
+    NONE, // F is up to date
+    ADD,
+    ADC,
+    SUB, // and CP
+    SBC,
+    AND,
+    XOR,
+    OR,
+    INC,
+    DEC,
+};
+
+struct LazyFlags {
+    FlagOp m_op = FlagOp::NONE;
+    uint8_t m_a = 0; // operands, b is 1 for INC/DEC
+    uint8_t m_b = 0;
+    uint8_t m_carry = 0; // carry in for ADC/SBC, the carry INC/DEC leave alone
+    uint8_t m_result = 0;
+};
+
 class Emulator {
   public:
     friend class Tester;
@@ -126,22 +180,58 @@ class Emulator {
 
     Emulator(Cart& cart, EmuSettings = {});
     void tick(const InputState& input); // one T-cycle tick
+
+    // Runs whole instructions until the given number of T-cycles have elapsed. The state at the end
+    // is identical to calling tick() that many times, an instruction may straddle the end
+    void run_for(int64_t cycles);
+    // runs until the PPU enters vblank, or for one frame's worth of cycles while the LCD is off
+    int64_t run_until_vblank();
+    // runs up to and including the next CPU step - an instruction, ISR dispatch or halted m-cycle
+    int64_t step();
+    void set_input(const InputState& input) { m_inputState = input; }
+
+    // did the last tick run a CPU step
     bool executed_instr_this_cycle() { return m_executedInstructionThisCycle; }
 
     uint16_t get_pc() const { return m_reg.pc; }
-    OpCodeInfo get_current_opcode() const {
-        const auto opByte = read_addr(m_reg.pc);
-        return m_prefix ? get_opcode_info_prefixed(opByte) : get_opcode_info(opByte);
-    }
+    uint8_t get_current_op_byte() const { return read_addr(m_reg.pc); }
+    bool is_current_op_prefixed() const { return m_prefix; }
 
     int64_t get_cycle_counter() const { return m_cycleCounter; };
-    int& get_last_written_addr() { return m_lastWrittenAddr; }
+    int64_t get_instruction_counter() const { return m_instructionCounter; };
+    int64_t get_idle_loop_hits() const { return m_idleLoopHits; }
+    int64_t get_idle_loop_skipped_cycles() const { return m_idleLoopSkippedCycles; }
+    const std::string& get_serial_output() const { return m_serialOutput; }
+    int& get_last_written_addr() { return m_lastWrittenAddr; } // only tracked with debug hooks
     bool want_breakpoint() { return m_wantBreakpoint; }
     void clear_want_breakpoint() { m_wantBreakpoint = false; }
+    bool get_debug_hooks() const { return m_settings.m_debugHooks; }
+    void set_debug_hooks(bool enable) { m_settings.m_debugHooks = enable; }
+    // records every instruction to a binary trace (see Trace.h) until stop_trace, with the
+    // DebugPolicy CPU
+    bool start_trace(const fs::path& path);
+    void stop_trace() { m_trace.reset(); }
+    bool is_tracing() const { return bool(m_trace); }
+    // counts cycles per instruction address and opcode (see Profiler.h) until stop_profiling, also
+    // with the DebugPolicy CPU. The counts survive stop_profiling, start_profiling clears them
+    void start_profiling();
+    void stop_profiling() { m_profiling = false; }
+    bool is_profiling() const { return m_profiling; }
+    const Profiler* get_profiler() const { return m_profiler.get(); } // nullptr if never started
 
     std::span<const rgba8> get_display_framebuffer() const {
         return m_ppu.get_display_framebuffer();
     };
+    // with EmuSettings::m_displayFormat INDEXED, expand_display_indices turns them into colours
+    std::span<const uint8_t> get_display_indices() const { return m_ppu.get_display_indices(); }
+    void expand_display_indices(std::span<const uint8_t> indices, std::span<rgba8> dst) const {
+        m_ppu.expand_display_indices(indices, dst);
+    }
+    const PPU::DisplayColors& get_display_colors() const { return m_settings.m_displayColors; }
+    void set_display_colors(const PPU::DisplayColors& colors) {
+        m_settings.m_displayColors = colors;
+        m_ppu.set_display_colors(colors);
+    }
     std::span<const rgba8> get_window_dbg_framebuffer() {
         return m_ppu.get_window_dbg_framebuffer();
     };
@@ -154,29 +244,130 @@ class Emulator {
     // for testing only
     const uint8_t* dbg_get_io_ptr(uint16_t addr) const;
 
+    // one instruction of a block generated by ezgb_recompile, see Recompiler.h
+    template <uint8_t OP, bool PREFIXED>
+    CompiledStep run_compiled_instr(uint32_t pcData, uint8_t size, int64_t untilCycle);
+
   protected:
-    void tick_countdowns();
-    void tick_timers();
-    void tick_interrupts();
+    void step_cpu(int64_t untilCycle); // a halted CPU idles up to untilCycle at most
+    bool dispatch_interrupts(); // true if an ISR was called
+    // earliest cycle an enabled interrupt might get requested, can be early but never late
+    int64_t get_next_interrupt_cycle() const;
+    int64_t get_tima_overflow_cycle() const; // cycle of the next TIMA overflow, NEVER if stopped
+
+    // idle loop detection, see IdleLoop
+    bool try_skip_idle_loop(int64_t untilCycle);
+    void track_idle_loop(uint16_t pc, uint16_t newPC, int cycles);
+    void note_idle_loop_read(uint16_t addr, uint8_t val) const;
+    int64_t get_next_idle_loop_change_cycle() const;
+
+    // CpuDispatch::CACHED and JIT, see BlockCache
+    // points m_block at the instruction at PC, or m_compiledBlock at a compiled block starting
+    // there, false if it can't be cached
+    bool find_block();
+    template <typename TPolicy>
+    void run_blocks(int64_t untilCycle);
+    // moves m_block on to the instruction after the one that just ran, or drops it
+    void next_block_instr(uint16_t nextPC);
+    void compile_block(Block& block); // CpuDispatch::JIT
+    static CompiledStep end_jit_instr(Emulator& emu, InstructionResult result, int64_t untilCycle,
+                                      uint32_t size); // Jit::EndInstrFn
+    static void sync_jit_flags(Emulator& emu); // Jit::SyncFlagsFn
+    Jit::Layout get_jit_layout() const;
+    template <typename TPolicy>
+    static Block decode_block(uint16_t pc, const uint8_t* code);
+    void clear_blocks(); // drops every cached block and unprotects their pages
+    const uint8_t* get_code_ptr(uint16_t pc) const; // nullptr if code there isn't cached
+    int64_t get_next_sync_cycle(int64_t untilCycle);
+    void protect_ram_page(int ramPage, bool writeProtect);
+    // shared by cached and compiled blocks, end returns false if the next instruction can't follow
+    // straight away
+    template <typename TPolicy>
+    uint16_t begin_block_instr();
+    template <typename TPolicy>
+    bool end_block_instr(uint16_t pc, const InstructionResult& result, int64_t untilCycle);
+
+    void sync_timers(int64_t cycle); // fire events through cycle
+    void sync_ppu(int64_t cycle);    // catch the PPU up through cycle
+    void sync_apu(int64_t cycle) const; // catch the APU up through cycle
+    void update_ppu_event_cycle();
+    void handle_event(const Event& event);
+
+    // DIV and TIMA aren't ticked, they're worked out from the cycle when read. Here cycle counts
+    // every cycle before it, so the CPU sees them as of m_cpuCycle + 1
+    uint16_t get_sysclk(int64_t cycle) const { return uint16_t(cycle - m_sysclkOrigin); }
+    uint8_t get_tima(int64_t cycle) const;
+    void sync_tima(int64_t cycle); // store get_tima in m_ioReg
+    void schedule_tima_overflow(); // after anything changes TIMA, TAC or the system clock
+    void reset_div(); // DIV writes and STOP, restarts the system clock from m_cpuCycle + 1
 
     AddrInfo get_addr_info(uint16_t address) const;
 
+    // writes from outside the handlers (ISR pushes, DMA, tests) are always tracked
+    template <typename TPolicy = DebugPolicy>
     void write_addr(uint16_t address, uint8_t val);
+    template <typename TPolicy = DebugPolicy>
     void write_addr_16(uint16_t address, uint16_t val);
+    void write_addr_slow(uint16_t address, uint8_t val);
 
     uint8_t read_addr(uint16_t address) const;
     uint16_t readAddr16(uint16_t address) const;
+    uint8_t read_addr_slow(uint16_t address) const;
+
+    uint32_t read_pc_data() const; // opcode and up to 3 bytes following it
+
+    void map_pages();
+    void map_cart_pages();
+    void map_vram_pages();
+
+    void start_oam_dma(uint8_t srcPage);
+    void sync_oam_dma(int64_t cycle); // copies every byte due by cycle into OAM
 
     void write_io(uint16_t addr, uint8_t val);
     uint8_t read_io(uint16_t addr) const;
 
-    InstructionResult handle_instr(uint32_t instruction);
-    InstructionResult handle_instr_prefixed(uint32_t instruction);
+    InstructionResult execute_instr(uint32_t pcData);
+
+    InstructionResult handle_instr(uint32_t pcData);
+    InstructionResult handle_instr_prefixed(uint32_t pcData);
+
+    // The handlers are shared by all CpuDispatch modes. TOpByte is a uint8_t for SWITCH or an
+    // OpConst for TABLE and CACHED, in which case operands and opcode info are resolved at compile
+    // time and the hooks are those of its policy. SWITCH always runs with DebugPolicy
+    template <typename TOpByte>
+    InstructionResult handle_instr_b0(uint32_t pcData, TOpByte opByte);
+    template <typename TOpByte>
+    InstructionResult handle_instr_b1(uint32_t pcData, TOpByte opByte);
+    template <typename TOpByte>
+    InstructionResult handle_instr_b2(uint32_t pcData, TOpByte opByte);
+    template <typename TOpByte>
+    InstructionResult handle_instr_b3(uint32_t pcData, TOpByte opByte);
+    template <typename TOpByte>
+    InstructionResult handle_instr_prefixed(uint32_t pcData, TOpByte opByte);
+
+    template <uint8_t OP, typename TPolicy>
+    struct OpConst : std::integral_constant<uint8_t, OP> {
+        using Policy = TPolicy;
+    };
+    template <typename TOpByte>
+    struct PolicyOf {
+        using type = DebugPolicy;
+    };
+    template <uint8_t OP, typename TPolicy>
+    struct PolicyOf<OpConst<OP, TPolicy>> {
+        using type = TPolicy;
+    };
+    using OpHandler = InstructionResult (*)(Emulator& emu, uint32_t pcData);
+
+    template <uint8_t OP, typename TPolicy>
+    static InstructionResult dispatch_op(Emulator& emu, uint32_t pcData);
+    template <uint8_t OP, typename TPolicy>
+    static InstructionResult dispatch_op_prefixed(Emulator& emu, uint32_t pcData);
 
-    InstructionResult handle_instr_b0(uint32_t pcdata);
-    InstructionResult handle_instr_b1(uint32_t pcdata);
-    InstructionResult handle_instr_b2(uint32_t pcdata);
-    InstructionResult handle_instr_b3(uint32_t pcdata);
+    template <typename TPolicy>
+    static const std::array<OpHandler, 256> s_opTable;
+    template <typename TPolicy>
+    static const std::array<OpHandler, 256> s_opTablePrefixed;
 
     bool get_flag(Flag flag) const;
     void set_flag(Flag flag);
@@ -184,6 +375,14 @@ class Emulator {
     void clear_flag(Flag flag);
     void clear_all_flags();
 
+    // The 8-bit ALU only records its operation and operands, Z/N/H/C are worked out when something
+    // reads them. Most are overwritten by the next ALU op first, and branches only need Z or C
+    void set_lazy_flags(FlagOp op, uint8_t a, uint8_t b, uint8_t result, uint8_t carry = 0);
+    bool get_lazy_carry() const;
+    uint8_t get_f() const; // F with any pending flags applied
+    void sync_flags();     // writes pending flags to F
+
+    template <typename TPolicy = DebugPolicy>
     void write_R8(R8 ra, uint8_t data);
     uint8_t read_R8(R8 ra) const;
 
@@ -201,14 +400,28 @@ class Emulator {
     Reg m_reg{};
     IOReg m_ioReg;
     PPU m_ppu{m_ioReg};
-    APU m_apu{m_ioReg};
+    // catching the APU up on a register read only does work early, nothing the CPU can see changes
+    mutable APU m_apu{m_ioReg};
 
     int64_t m_cycleCounter = 0;
+    int64_t m_instructionCounter = 0;
 
     int m_lastWrittenAddr = -2;
-    int m_cyclesToWait = 0;
     bool m_executedInstructionThisCycle = false;
 
+    // The CPU runs at discrete cycles, everything else is advanced up to them on demand. At the CPU
+    // cycle events and timers have run through that cycle. The PPU and APU lag behind and are only
+    // caught up (through the cycle before the CPU's) when the CPU touches their registers, when the
+    // PPU reaches a mode change or LY increment, and at the end of run_for
+    Scheduler m_scheduler;
+    int64_t m_cpuCycle = 0;              // cycle of the next CPU step
+    int64_t m_lastCpuCycle = -1;         // cycle of the previous CPU step
+    int64_t m_sysclkOrigin = 0;          // cycle the system clock was last reset on
+    int64_t m_timaCycle = 0;             // m_ioReg->m_tima includes every increment before this
+    int64_t m_ppuCycle = 0;              // next cycle the PPU hasn't run
+    int64_t m_ppuEventCycle = 0;         // cycle the PPU next changes anything the CPU can see
+    mutable int64_t m_apuCycle = 0;      // next cycle the APU hasn't run
+
     bool m_stopMode = false;
 
     bool m_haltMode = false;
@@ -216,18 +429,55 @@ class Emulator {
     bool m_haltBugTriggered = false;
 
     bool m_prefix = false; // was last instruction CB prefix
-    bool m_interruptMasterEnable = false;
-    int m_pendingInterruptEnableCycleCount = 0; // enable interrupts when goes below 0
+    LazyFlags m_lazyFlags;   // F is only current while m_op is NONE, always so between run_for calls
+    bool m_interruptMasterEnable = false; // EI/RETI set it via EventType::IME_ENABLE
 
     bool m_wantBreakpoint = false;
 
-    uint16_t m_sysclk = 0;               // t cycles
-    int m_pendingTimaOverflowCycles = 0; // t cycles until TIMA overflow
-
-    int m_oamDmaCyclesRemaining = 0;
+    // While an OAM DMA runs the CPU can only reach IO and HRAM, so the source can't change under
+    // it and is copied up front. The bytes land in OAM one per M-cycle, caught up lazily like the
+    // PPU. Every page is unmapped for the duration, so the slow path does the blocking
+    static constexpr int OAM_DMA_BYTES = PPU::OAM_ADDR_RANGE.width();
+    bool m_oamDmaActive = false;
+    std::array<uint8_t, OAM_DMA_BYTES> m_oamDmaData{};
+    int64_t m_oamDmaStartCycle = 0; // byte i lands on m_oamDmaStartCycle + i M-cycles
+    int m_oamDmaBytesCopied = OAM_DMA_BYTES;
+
+    // A short backward loop being watched for polling. If an iteration writes nothing, only reads
+    // memory whose future is known (ROM, RAM, HRAM, IE, LYC and the timed LY, STAT, IF and DIV) and
+    // ends in the same registers it started with, every following iteration is identical until one
+    // of those timed registers changes. The CPU then skips to that cycle in whole iterations
+    struct IdleLoop {
+        static constexpr int MAX_LOOP_BYTES = 16;
+        static constexpr int MAX_TIMED_READS = 4;
+
+        int m_start = -1; // PC the loop branches back to, -1 if not watching a loop
+        int m_end = -1;   // PC of the backward branch
+        int m_branchCycles = 0;
+
+        // state on the last arrival at m_start
+        Reg m_reg{};
+        bool m_ime = false;
+        int64_t m_cycle = -1;
+        int64_t m_instructionCounter = 0;
+
+        // what the iteration since then did
+        bool m_pure = false;
+        bool m_readsDiv = false;
+        int m_numTimedReads = 0;
+        std::array<std::pair<uint16_t, uint8_t>, MAX_TIMED_READS> m_timedReads{};
+    };
+    mutable IdleLoop m_idleLoop; // reads are const, but have to be noted
+    int64_t m_idleLoopHits = 0;
+    int64_t m_idleLoopSkippedCycles = 0;
 
     void maybe_log_registers() const;
-    void maybe_log_opcode(const OpCodeInfo& oc) const;
+    void maybe_log_opcode(uint8_t opByte, bool prefixed) const;
+    void maybe_trace_instr(uint8_t opByte);
+    std::unique_ptr<TraceWriter> m_trace;
+    void maybe_profile_instr(uint16_t pc, uint8_t opByte, bool prefixed, int cycles);
+    std::unique_ptr<Profiler> m_profiler;
+    bool m_profiling = false;
 
     static constexpr size_t HRAM_BYTES = 128;
     static constexpr size_t RAM_BYTES = 8 * 1024;
@@ -239,9 +489,236 @@ class Emulator {
 
     std::string m_serialOutput;
 
+    // CPU memory map, one direct pointer per 256 byte page. Pages that need a handler (IO, OAM,
+    // locked VRAM, MBC registers, ...) are nullptr and go through read_addr_slow/write_addr_slow
+    static constexpr int PAGE_SIZE = 256;
+    static constexpr int PAGE_COUNT = 0x10000 / PAGE_SIZE;
+    std::array<const uint8_t*, PAGE_COUNT> m_readPages{};
+    std::array<uint8_t*, PAGE_COUNT> m_writePages{};
+    bool m_vramMapped = false;
+
+    // Cached code and the CPU's place in it. RAM pages holding cached code are unmapped for writes,
+    // so writing one goes through write_addr_slow and drops its blocks. ROM never changes and HRAM
+    // writes always take the slow path
+    BlockCache m_blockCache;
+    Block* m_block = nullptr;
+    int m_blockIndex = 0;
+    uint16_t m_blockPC = 0; // PC of m_block->m_instrs[m_blockIndex]
+    std::array<bool, RAM_BYTES / PAGE_SIZE> m_ramCodePages{};
+    bool m_hramCode = false;
+    bool m_slowWrite = false; // the last instruction wrote through write_addr_slow
+
+    // EmuSettings::m_compiledRom, keyed like BlockCache and looked up before it
+    std::unordered_map<const uint8_t*, CompiledBlockFn> m_compiledBlocks;
+    CompiledBlockFn m_compiledBlock = nullptr; // at PC, found by find_block
+
+    // CpuDispatch::JIT, native code for the blocks in m_blockCache
+    Jit m_jit{&Emulator::end_jit_instr, get_jit_layout()};
+    int64_t m_jitSyncCycle = 0; // get_next_sync_cycle while native code runs, see Jit::Layout
+
+    // EmuSettings::m_debugHooks (or tracing or profiling) as of the start of run_for, cached
+    // blocks hold handlers for it
+    bool m_debugPolicy = false;
+
     Cart& m_cart;
     EmuSettings m_settings{};
 
     InputState m_inputState{};
 };
+
+template <uint8_t OP, bool PREFIXED>
+CompiledStep Emulator::run_compiled_instr(uint32_t pcData, uint8_t size, int64_t untilCycle) {
+    // find_block only enters compiled blocks without debug hooks
+    const auto pc = begin_block_instr<FastPolicy>();
+    InstructionResult result;
+    if constexpr (PREFIXED) {
+        result = dispatch_op_prefixed<OP, FastPolicy>(*this, pcData);
+    } else {
+        result = dispatch_op<OP, FastPolicy>(*this, pcData);
+    }
+    if (!end_block_instr<FastPolicy>(pc, result, untilCycle)) {
+        return CompiledStep::STOP;
+    }
+    return m_reg.pc == uint16_t(pc + size) ? CompiledStep::NEXT : CompiledStep::JUMPED;
+}
+
+// register and flag accessors are forced inline so constant operands fold away in the handlers
+
+EZ_FORCE_INLINE bool Emulator::get_flag(Flag flag) const {
+    if (m_lazyFlags.m_op != FlagOp::NONE) {
+        // conditional branches and carry ins don't need the rest of F
+        if (flag == Flag::ZERO) {
+            return m_lazyFlags.m_result == 0;
+        }
+        if (flag == Flag::CARRY) {
+            return get_lazy_carry();
+        }
+        return ((0x1 << +flag) & get_f()) != 0x0;
+    }
+    return ((0x1 << +flag) & m_reg.f) != 0x0;
+}
+
+EZ_FORCE_INLINE void Emulator::set_flag(Flag flag) {
+    sync_flags();
+    m_reg.f |= (0x1 << +flag);
+}
+
+EZ_FORCE_INLINE void Emulator::set_flag(Flag flag, bool value) {
+    return value ? set_flag(flag) : clear_flag(flag);
+}
+
+EZ_FORCE_INLINE void Emulator::clear_flag(Flag flag) {
+    sync_flags();
+    m_reg.f &= ~(0x1 << +flag);
+}
+
+EZ_FORCE_INLINE void Emulator::clear_all_flags() {
+    m_lazyFlags.m_op = FlagOp::NONE;
+    m_reg.f = 0x00;
+}
+
+EZ_FORCE_INLINE void Emulator::set_lazy_flags(FlagOp op, uint8_t a, uint8_t b, uint8_t result,
+                                              uint8_t carry) {
+    m_lazyFlags = {op, a, b, carry, result};
+}
+
+EZ_FORCE_INLINE bool Emulator::get_lazy_carry() const {
+    const auto& lazy = m_lazyFlags;
+    switch (lazy.m_op) {
+        case FlagOp::ADD: return get_flag_c_add(lazy.m_a, lazy.m_b);
+        case FlagOp::ADC: return get_flag_c_adc(lazy.m_a, lazy.m_b, lazy.m_carry);
+        case FlagOp::SUB: return get_flag_c_sub(lazy.m_a, lazy.m_b);
+        case FlagOp::SBC: return get_flag_c_sbc(lazy.m_a, lazy.m_b, lazy.m_carry);
+        case FlagOp::INC: [[fallthrough]];
+        case FlagOp::DEC: return lazy.m_carry;
+        default:          return false;
+    }
+}
+
+inline uint8_t Emulator::get_f() const {
+    const auto& lazy = m_lazyFlags;
+    auto negative = false;
+    auto halfCarry = false;
+    switch (lazy.m_op) {
+        case FlagOp::NONE: return m_reg.f;
+        case FlagOp::ADD:  [[fallthrough]];
+        case FlagOp::INC:  halfCarry = get_flag_hc_add(lazy.m_a, lazy.m_b); break;
+        case FlagOp::ADC:  halfCarry = get_flag_hc_adc(lazy.m_a, lazy.m_b, lazy.m_carry); break;
+        case FlagOp::SUB:  [[fallthrough]];
+        case FlagOp::DEC:
+            negative = true;
+            halfCarry = get_flag_hc_sub(lazy.m_a, lazy.m_b);
+            break;
+        case FlagOp::SBC:
+            negative = true;
+            halfCarry = get_flag_hc_sbc(lazy.m_a, lazy.m_b, lazy.m_carry);
+            break;
+        case FlagOp::AND: halfCarry = true; break;
+        default:          break;
+    }
+    return uint8_t((lazy.m_result == 0) << +Flag::ZERO | negative << +Flag::NEGATIVE |
+                   halfCarry << +Flag::HALF_CARRY | get_lazy_carry() << +Flag::CARRY);
+}
+
+EZ_FORCE_INLINE void Emulator::sync_flags() {
+    if (m_lazyFlags.m_op != FlagOp::NONE) {
+        m_reg.f = get_f();
+        m_lazyFlags.m_op = FlagOp::NONE;
+    }
+}
+
+EZ_FORCE_INLINE uint16_t Emulator::read_R16Mem(R16Mem r16) const {
+    switch (r16) {
+        case R16Mem::BC:  return m_reg.bc;
+        case R16Mem::DE:  return m_reg.de;
+        case R16Mem::HLI: return m_reg.hl;
+        case R16Mem::HLD: return m_reg.hl;
+        default:          fail("not implemented");
+    }
+}
+
+EZ_FORCE_INLINE bool Emulator::get_Cond(Cond c) const {
+    switch (c) {
+        case Cond::Z:  return get_flag(Flag::ZERO);
+        case Cond::NZ: return !get_flag(Flag::ZERO);
+        case Cond::C:  return get_flag(Flag::CARRY);
+        case Cond::NC: return !get_flag(Flag::CARRY);
+        default:       fail("not implemented");
+    }
+}
+
+EZ_FORCE_INLINE uint16_t Emulator::read_R16(R16 r16) const {
+    switch (r16) {
+        case R16::BC: return m_reg.bc;
+        case R16::DE: return m_reg.de;
+        case R16::HL: return m_reg.hl;
+        case R16::SP: return m_reg.sp;
+        default:      fail("not implemented");
+    }
+}
+
+EZ_FORCE_INLINE void Emulator::write_R16(R16 r16, uint16_t data) {
+    switch (r16) {
+        case R16::BC: m_reg.bc = data; break;
+        case R16::DE: m_reg.de = data; break;
+        case R16::HL: m_reg.hl = data; break;
+        case R16::SP: m_reg.sp = data; break;
+        default:      fail("not implemented");
+    }
+}
+
+EZ_FORCE_INLINE uint16_t Emulator::read_R16Stack(R16Stack r16) const {
+    switch (r16) {
+        case R16Stack::BC: return m_reg.bc;
+        case R16Stack::DE: return m_reg.de;
+        case R16Stack::HL: return m_reg.hl;
+        case R16Stack::AF: return uint16_t(m_reg.a << 8 | get_f());
+        default:           fail("not implemented");
+    }
+}
+
+EZ_FORCE_INLINE void Emulator::write_R16Stack(R16Stack r16, uint16_t data) {
+    switch (r16) {
+        case R16Stack::BC: m_reg.bc = data; break;
+        case R16Stack::DE: m_reg.de = data; break;
+        case R16Stack::HL: m_reg.hl = data; break;
+        case R16Stack::AF: {
+            m_reg.af = data;
+            m_reg.f &= 0xF0; // bottom bits of flags are always 0
+            m_lazyFlags.m_op = FlagOp::NONE;
+            break;
+        }
+        default: fail("not implemented");
+    }
+}
+
+EZ_FORCE_INLINE uint8_t Emulator::read_R8(R8 r8) const {
+    switch (r8) {
+        case R8::B:       return m_reg.b;
+        case R8::C:       return m_reg.c;
+        case R8::D:       return m_reg.d;
+        case R8::E:       return m_reg.e;
+        case R8::H:       return m_reg.h;
+        case R8::L:       return m_reg.l;
+        case R8::HL_ADDR: return read_addr(m_reg.hl);
+        case R8::A:       return m_reg.a;
+        default:          fail("not implemented");
+    }
+}
+
+template <typename TPolicy>
+EZ_FORCE_INLINE void Emulator::write_R8(R8 r8, uint8_t data) {
+    switch (r8) {
+        case R8::B:       m_reg.b = data; break;
+        case R8::C:       m_reg.c = data; break;
+        case R8::D:       m_reg.d = data; break;
+        case R8::E:       m_reg.e = data; break;
+        case R8::H:       m_reg.h = data; break;
+        case R8::L:       m_reg.l = data; break;
+        case R8::HL_ADDR: write_addr<TPolicy>(m_reg.hl, data); break;
+        case R8::A:       m_reg.a = data; break;
+        default:          fail("not implemented");
+    }
+}
+
 } // namespace ez
\ No newline at end of file
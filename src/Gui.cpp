@@ -130,6 +130,9 @@ void Gui::draw() {
         draw_settings();
         draw_console();
         draw_instructions();
+        if (m_showProfiler) {
+            draw_profiler();
+        }
         if (m_showPPU) {
             draw_ppu();
         }
@@ -325,6 +328,7 @@ void Gui::draw_toolbar() {
         }
         if (ImGui::BeginMenu("Options")) {
             ImGui::Checkbox("Show PPU Debug Panel", &m_showPPU);
+            ImGui::Checkbox("Show Profiler", &m_showProfiler);
             ImGui::Checkbox("Show ImGui Demo Window", &m_showDemoWindow);
             ImGui::Checkbox("Mobile Layout (Refresh Required to Undo)", &m_mobileLayout);
             ImGui::EndMenu();
@@ -419,7 +423,11 @@ void Gui::draw_registers() {
         if (ImGui::CollapsingHeader("Timers", ImGuiTreeNodeFlags_DefaultOpen)) {
             auto& ioReg = m_state.m_emu->m_ioReg;
             ImGui::LabelText("T-CYCLES", "{}"_format(m_state.m_emu->get_cycle_counter()).c_str());
-            ImGui::LabelText("SYSCLK", "{}"_format(m_state.m_emu->m_sysclk).c_str());
+            ImGui::LabelText("IDLE SKIPS", "{}"_format(m_state.m_emu->get_idle_loop_hits()).c_str());
+            ImGui::LabelText("IDLE CYCLES",
+                             "{}"_format(m_state.m_emu->get_idle_loop_skipped_cycles()).c_str());
+            const auto sysclk = m_state.m_emu->get_sysclk(m_state.m_emu->get_cycle_counter());
+            ImGui::LabelText("SYSCLK", "{}"_format(sysclk).c_str());
             ImGui::LabelText("DIV", "{}"_format(ioReg->m_timerDivider).c_str());
             ImGui::LabelText("TIMA Enabled", "{}"_format(bool(ioReg->m_tac & 0b100)).c_str());
             ImGui::LabelText("TIMA", "{}"_format(ioReg->m_tima).c_str());
@@ -556,6 +564,30 @@ void Gui::draw_settings() {
     if (ImGui::Begin("Settings", nullptr, getWindowFlags())) {
         ImGui::Checkbox("Skip Bootrom", &emu.m_settings.m_skipBootROM);
         ImGui::Checkbox("Log", &emu.m_settings.m_logEnable);
+        ImGui::Checkbox("Debug Hooks", &emu.m_settings.m_debugHooks);
+        auto dispatch = int(+emu.m_settings.m_cpuDispatch);
+        if (ImGui::Combo("CPU Dispatch", &dispatch, "Switch\0Table\0Cached\0JIT\0")) {
+            emu.m_settings.m_cpuDispatch = CpuDispatch(dispatch);
+        }
+        ImGui::Checkbox("Skip Idle Loops", &emu.m_settings.m_skipIdleLoops);
+        auto displayColors = emu.get_display_colors();
+        auto colorsChanged = false;
+        for (auto i = 0; i < PPU::PALETTE_COLORS; ++i) {
+            auto& color = displayColors[i];
+            auto rgb = std::array<float, 3>{color.x / 255.0f, color.y / 255.0f, color.z / 255.0f};
+            if (ImGui::ColorEdit3("Shade {}"_format(i).c_str(), rgb.data(),
+                                  ImGuiColorEditFlags_NoInputs)) {
+                color = rgba8{uint8_t(rgb[0] * 255.0f + 0.5f), uint8_t(rgb[1] * 255.0f + 0.5f),
+                              uint8_t(rgb[2] * 255.0f + 0.5f), 0xFF};
+                colorsChanged = true;
+            }
+            if (i + 1 < PPU::PALETTE_COLORS) {
+                ImGui::SameLine();
+            }
+        }
+        if (colorsChanged) {
+            emu.set_display_colors(displayColors);
+        }
         ImGui::DragInt(
             "PC Break Addr", &m_state.m_debugSettings.m_breakOnPC, 1.0f, -1, INT16_MAX, "%04x");
         ImGui::DragInt(
@@ -591,7 +623,8 @@ void Gui::draw_console() {
 void Gui::draw_instructions() {
     const auto justPaused = update(m_prevWasPaused, m_state.m_isPaused) && m_state.m_isPaused;
     auto& emu = *m_state.m_emu;
-    put_next_window({3, 0}, {1, 3});
+    // the profiler takes the bottom half when it's open
+    put_next_window({3, 0}, {1, m_showProfiler ? 1.5f : 3.0f});
     if (ImGui::Begin("Instructions", nullptr, getWindowFlags())) {
         std::optional<int> scrollToLine;
         if (ImGui::Button("Refresh") || m_opCache.empty() || justPaused) {
@@ -700,6 +733,71 @@ void Gui::draw_instructions() {
     ImGui::End();
 }
 
+void Gui::draw_profiler() {
+    static constexpr size_t maxHotSpots = 100;
+    auto& emu = *m_state.m_emu;
+    put_next_window({3, 1.5f}, {1, 1.5f});
+    if (ImGui::Begin("Profiler", nullptr, getWindowFlags())) {
+        auto profiling = emu.is_profiling();
+        if (ImGui::Checkbox("Profile", &profiling)) {
+            if (profiling) {
+                emu.start_profiling();
+            } else {
+                emu.stop_profiling();
+            }
+        }
+        const auto profiler = emu.get_profiler();
+        if (profiler) {
+            ImGui::SameLine();
+            ImGui::Text("{} instructions, {} cycles"_format(profiler->get_total_hits(),
+                                                             profiler->get_total_cycles())
+                            .c_str());
+        }
+        const auto numCols = 5;
+        if (profiler && ImGui::BeginTable("Hot Spot Table",
+                                          numCols,
+                                          ImGuiTableFlags_ScrollY | ImGuiTableFlags_Resizable)) {
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableSetupColumn("Addr", ImGuiTableColumnFlags_None);
+            ImGui::TableSetupColumn("Mnemonic", ImGuiTableColumnFlags_None);
+            ImGui::TableSetupColumn("Cycles", ImGuiTableColumnFlags_None);
+            ImGui::TableSetupColumn("%", ImGuiTableColumnFlags_None);
+            ImGui::TableSetupColumn("Hits", ImGuiTableColumnFlags_None);
+            ImGui::TableHeadersRow();
+            const auto totalCycles = std::max<int64_t>(profiler->get_total_cycles(), 1);
+            for (const auto& spot : profiler->get_hot_spots(maxHotSpots)) {
+                ImGui::TableNextRow();
+                if (emu.m_reg.pc == spot.m_pc) {
+                    ImGui::TableSetBgColor(ImGuiTableBgTarget_RowBg0, ImColor(blue));
+                }
+                ImGui::TableNextColumn();
+                const auto addrText = spot.m_bank == Profiler::NO_BANK
+                                          ? "   {:04x}"_format(spot.m_pc)
+                                          : "{:02x}:{:04x}"_format(spot.m_bank, spot.m_pc);
+                ImGui::Text(addrText.c_str());
+
+                ImGui::TableNextColumn();
+                const auto info = spot.m_prefixed ? get_opcode_info_prefixed(spot.m_opcode)
+                                                  : get_opcode_info(spot.m_opcode);
+                ImGui::Text("{} {} {}"_format(info.m_mnemonic,
+                                              info.m_operandName1,
+                                              info.m_operandName2)
+                                .c_str());
+
+                ImGui::TableNextColumn();
+                ImGui::Text("{}"_format(spot.m_cycles).c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text("{:.1f}"_format(100.0 * double(spot.m_cycles) / double(totalCycles))
+                                .c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text("{}"_format(spot.m_hits).c_str());
+            }
+            ImGui::EndTable();
+        }
+    }
+    ImGui::End();
+}
+
 void Gui::draw_display() {
     const auto left = m_mobileLayout ? 0.0f : 1.0f;
     const auto width = m_mobileLayout ? 4.0f : 2.0f;
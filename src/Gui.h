@@ -30,6 +30,7 @@ class Gui {
     void draw_settings();
     void draw_console();
     void draw_instructions();
+    void draw_profiler();
     void draw_display();
     void draw_ppu();
     void draw_popups();
@@ -47,6 +48,7 @@ class Gui {
     bool m_shouldExit = false;
     bool m_showDemoWindow = false;
     bool m_showPPU = false;
+    bool m_showProfiler = false;
     bool m_followPC = true;
 
     bool m_mobileLayoutDismissed = false;
@@ -1,5 +1,6 @@
 #pragma once
 #include "Base.h"
+#include <bit>
 
 namespace ez {
 
@@ -78,6 +79,7 @@ enum class IOAddr : uint16_t {
     WX = 0xFF4B,           // Window X position plus 7	R/W	All
     KEY1 = 0xFF4D,         // Prepare speed switch	Mixed	CGB
     VBK = 0xFF4F,          // VRAM bank	R/W	CGB
+    BANK = 0xFF50,         // Boot ROM mapping control	W	All
     HDMA1 = 0xFF51,        // VRAM DMA source high	W	CGB
     HDMA2 = 0xFF52,        // VRAM DMA source low	W	CGB
     HDMA3 = 0xFF53,        // VRAM DMA destination high	W	CGB
@@ -136,6 +138,16 @@ struct alignas(uint8_t) LCDRegisters {
 };
 static_assert(sizeof(LCDRegisters) == 12);
 
+// in priority order, bit n of IF and IE
+enum class Interrupts {
+    VBLANK = 0,
+    LCD = 1,
+    TIMER = 2,
+    SERIAL = 3,
+    JOYPAD = 4,
+    NUM_INTERRUPTS
+};
+
 struct InterruptControl {
     bool vblank : 1;
     bool lcd : 1;
@@ -143,6 +155,18 @@ struct InterruptControl {
     bool serial : 1;
     bool joypad : 1;
     uint8_t detail_unused : 3;
+
+    static constexpr uint8_t INTERRUPT_BITS = 0x1F;
+
+    uint8_t get_mask() const { return std::bit_cast<uint8_t>(*this) & INTERRUPT_BITS; }
+    void request(Interrupts interrupt) {
+        *this = std::bit_cast<InterruptControl>(
+            uint8_t(std::bit_cast<uint8_t>(*this) | (0b1 << +interrupt)));
+    }
+    void acknowledge(Interrupts interrupt) {
+        *this = std::bit_cast<InterruptControl>(
+            uint8_t(std::bit_cast<uint8_t>(*this) & ~(0b1 << +interrupt)));
+    }
 };
 static_assert(sizeof(InterruptControl) == sizeof(uint8_t));
 
@@ -217,15 +241,6 @@ using IOReg = Addressable<IORegisters, IO_ADDR_RANGE.m_min>;
 
 static constexpr iRange HRAM_ADDR_RANGE = {0xFF80, 0xFFFF};
 
-enum class Interrupts {
-    VBLANK = 0,
-    LCD = 1,
-    TIMER = 2,
-    SERIAL = 3,
-    JOYPAD = 4,
-    NUM_INTERRUPTS
-};
-
 struct InputState {
     bool m_a = false;
     bool m_b = false;
@@ -0,0 +1,599 @@
+#include "Jit.h"
+#include "BlockCache.h"
+#include "Emulator.h"
+#include "OpCodes.h"
+
+#if EZ_JIT_X64
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+namespace ez {
+namespace {
+
+#if EZ_JIT_X64
+
+constexpr size_t BLOCK_ALIGN = 16;
+
+// x86 condition codes, the low nibble of jcc
+enum class X86Cond : uint8_t {
+    E = 0x4,
+    NE = 0x5,
+    L = 0xC,
+    GE = 0xD,
+    G = 0xF,
+};
+
+// the handful of x86-64 instructions blocks are made of, as raw bytes
+class Assembler {
+  public:
+    template <typename... TBytes>
+    void emit(TBytes... bytes) {
+        (m_code.push_back(uint8_t(bytes)), ...);
+    }
+    template <typename T>
+    void emit_imm(T value) {
+        const auto offset = m_code.size();
+        m_code.resize(offset + sizeof(value));
+        memcpy(m_code.data() + offset, &value, sizeof(value));
+    }
+    // ModRM and displacement of [rbx + disp], the emulator member at disp
+    void mem(uint8_t reg, int32_t disp) {
+        emit(0x80 | reg << 3 | 0x03);
+        emit_imm(disp);
+    }
+    // a rel32 emitted at offset, relative to the end of the instruction it ends
+    void patch_rel32(size_t offset, size_t target) {
+        const auto rel = int32_t(int64_t(target) - int64_t(offset + sizeof(int32_t)));
+        memcpy(m_code.data() + offset, &rel, sizeof(rel));
+    }
+    // jumps to be patched, they return the offset of their rel32
+    size_t jcc(X86Cond cond) {
+        emit(0x0F, 0x80 | +cond);
+        return rel32();
+    }
+    size_t jmp() {
+        emit(0xE9);
+        return rel32();
+    }
+    void bind(size_t jump) { patch_rel32(jump, size()); }
+    void call(uint64_t fn) {
+        emit(0x48, 0xB8); // mov rax, imm64
+        emit_imm(fn);
+        emit(0xFF, 0xD0); // call rax
+    }
+
+    size_t size() const { return m_code.size(); }
+    const std::vector<uint8_t>& get_code() const { return m_code; }
+
+  private:
+    size_t rel32() {
+        const auto offset = size();
+        emit_imm(int32_t(0));
+        return offset;
+    }
+
+    std::vector<uint8_t> m_code;
+};
+
+// Jit::BlockFn. rbx holds the emulator and r12 untilCycle throughout, the emulator's registers stay
+// in memory
+class BlockAssembler {
+  public:
+    BlockAssembler(const Block& block, const Jit::Layout& layout, Jit::EndInstrFn endInstr)
+        : m_block(block)
+        , m_layout(layout)
+        , m_endInstr(endInstr) {
+        auto pc = block.m_pc;
+        for (const auto& instr : block.m_instrs) {
+            m_pcs.push_back(pc);
+            pc = uint16_t(pc + instr.m_size);
+        }
+    }
+
+    std::vector<uint8_t> assemble();
+    int get_inline_instrs() const { return m_inlineInstrs; }
+
+  private:
+    // leaves the native code with m_step in eax
+    struct Exit {
+        std::vector<size_t> m_jumps;
+        uint16_t m_pc = 0;
+        int m_cycles = 0;      // of the instruction that left, for m_lastCpuCycle
+        int m_resumeIndex = -1; // instruction the block carries on at next time, -1 to drop it
+        CompiledStep m_step = CompiledStep::STOP;
+    };
+
+    // track_idle_loop while a loop is watched, out of the way too
+    struct IdleLoopStub {
+        size_t m_jump = 0;
+        size_t m_back = 0; // where the instruction carries on
+        uint16_t m_pc = 0;
+        int m_cycles = 0;
+    };
+
+    bool assemble_inline(int index); // false if the handler has to run the instruction
+    void assemble_call(int index);
+    void assemble_alu(int aluOp, int8_t r8, uint8_t u8); // r8 < 0 for the u8 forms
+    void end_instr(int index, uint16_t newPC, int cycles, bool jumped);
+    void track_idle_loop(uint16_t pc, uint16_t newPC, int cycles);
+    void assemble_idle_loop_stub(const IdleLoopStub& stub);
+    void cmp_mem32(int32_t disp, int32_t value);
+    void mov_mem32(int32_t disp, int32_t value);
+    void sync_flags();
+    void store_flags(FlagOp op);
+    int find_instr(uint16_t pc) const; // -1 if no instruction of the block starts there
+
+    Assembler m_code;
+    const Block& m_block;
+    const Jit::Layout& m_layout;
+    Jit::EndInstrFn m_endInstr = nullptr;
+    std::vector<uint16_t> m_pcs;
+    std::vector<size_t> m_instrOffsets;
+    std::vector<Exit> m_exits;
+    std::vector<IdleLoopStub> m_idleLoopStubs;
+    std::vector<std::pair<size_t, int>> m_links; // jumps to instructions of the block
+    std::vector<size_t> m_epilogueJumps;         // with the end function's CompiledStep in al
+    bool m_flagsSynced = true; // the native code is entered with F up to date
+    int m_inlineInstrs = 0;
+};
+
+std::vector<uint8_t> BlockAssembler::assemble() {
+    static_assert(uint8_t(CompiledStep::NEXT) == 0);
+    m_code.emit(0x53);                   // push rbx
+    m_code.emit(0x41, 0x54);             // push r12
+    m_code.emit(0x48, 0x83, 0xEC, 0x08); // sub rsp, 8 - calls need a 16 byte aligned stack
+    m_code.emit(0x48, 0x89, 0xFB);       // mov rbx, rdi
+    m_code.emit(0x49, 0x89, 0xF4);       // mov r12, rsi
+
+    // jump to instruction startIndex, the table holds their offsets from the table
+    m_code.emit(0x48, 0x63, 0xD2);       // movsxd rdx, edx
+    m_code.emit(0x48, 0x8D, 0x05);       // lea rax, [rip + table]
+    const auto tableRel = m_code.size();
+    m_code.emit_imm(int32_t(0));
+    m_code.emit(0x48, 0x63, 0x0C, 0x90); // movsxd rcx, dword [rax + rdx * 4]
+    m_code.emit(0x48, 0x01, 0xC8);       // add rax, rcx
+    m_code.emit(0xFF, 0xE0);             // jmp rax
+
+    for (int i = 0; i < int(m_block.m_instrs.size()); ++i) {
+        m_instrOffsets.push_back(m_code.size());
+        if (assemble_inline(i)) {
+            ++m_inlineInstrs;
+        } else {
+            assemble_call(i);
+        }
+    }
+
+    // the CompiledStep is in al
+    const auto epilogue = m_code.size();
+    m_code.emit(0x48, 0x83, 0xC4, 0x08); // add rsp, 8
+    m_code.emit(0x41, 0x5C);             // pop r12
+    m_code.emit(0x5B);                   // pop rbx
+    m_code.emit(0xC3);                   // ret
+    for (const auto jump : m_epilogueJumps) {
+        m_code.patch_rel32(jump, epilogue);
+    }
+
+    // what run_blocks would have left behind after the instruction, out of the way
+    for (const auto& stub : m_idleLoopStubs) {
+        m_code.bind(stub.m_jump);
+        assemble_idle_loop_stub(stub);
+    }
+    for (const auto& exit : m_exits) {
+        for (const auto jump : exit.m_jumps) {
+            m_code.bind(jump);
+        }
+        m_code.emit(0x66, 0xC7); // mov word [pc], newPC
+        m_code.mem(0, m_layout.m_pc);
+        m_code.emit_imm(exit.m_pc);
+        m_code.emit(0x48, 0x8B); // mov rax, [cpuCycle]
+        m_code.mem(0, m_layout.m_cpuCycle);
+        m_code.emit(0x48, 0x2D); // sub rax, cycles
+        m_code.emit_imm(int32_t(exit.m_cycles));
+        m_code.emit(0x48, 0x89); // mov [lastCpuCycle], rax
+        m_code.mem(0, m_layout.m_lastCpuCycle);
+        if (exit.m_resumeIndex >= 0) {
+            m_code.emit(0xC7); // mov dword [blockIndex], resumeIndex
+            m_code.mem(0, m_layout.m_blockIndex);
+            m_code.emit_imm(int32_t(exit.m_resumeIndex));
+            m_code.emit(0x66, 0xC7); // mov word [blockPC], newPC
+            m_code.mem(0, m_layout.m_blockPC);
+            m_code.emit_imm(exit.m_pc);
+        } else {
+            m_code.emit(0x48, 0xC7); // mov qword [block], 0
+            m_code.mem(0, m_layout.m_block);
+            m_code.emit_imm(int32_t(0));
+        }
+        m_code.emit(0xB8); // mov eax, step
+        m_code.emit_imm(uint32_t(exit.m_step));
+        m_code.patch_rel32(m_code.jmp(), epilogue);
+    }
+    for (const auto& [jump, index] : m_links) {
+        m_code.patch_rel32(jump, m_instrOffsets[index]);
+    }
+
+    while (m_code.size() % sizeof(int32_t) != 0) {
+        m_code.emit(0xCC); // int3
+    }
+    const auto table = m_code.size();
+    m_code.patch_rel32(tableRel, table);
+    for (const auto offset : m_instrOffsets) {
+        m_code.emit_imm(int32_t(int64_t(offset) - int64_t(table)));
+    }
+    return m_code.get_code();
+}
+
+bool BlockAssembler::assemble_inline(int index) {
+    const auto& instr = m_block.m_instrs[index];
+    if (instr.m_prefixed) {
+        return false;
+    }
+    const auto op = uint8_t(instr.m_pcData);
+    const auto u8 = uint8_t(instr.m_pcData >> 8);
+    const auto u16 = uint16_t(instr.m_pcData >> 8);
+    const auto& timing = OPCODE_TIMINGS[op];
+    const auto pc = m_pcs[index];
+    const auto nextPC = uint16_t(pc + timing.m_size);
+    // (HL) goes through memory, leave those to the handlers
+    constexpr auto HL_ADDR = +R8::HL_ADDR;
+    const auto dstR8 = (op >> 3) & 0b111;
+    const auto srcR8 = op & 0b111;
+    const auto r16 = (op >> 4) & 0b11;
+
+    if (op == +OpCode::NOP) {
+        // only the cycles
+    } else if ((op & 0b1100'0000) == 0b0100'0000 && dstR8 != HL_ADDR && srcR8 != HL_ADDR) {
+        m_code.emit(0x8A); // mov al, [src]
+        m_code.mem(0, m_layout.m_r8[srcR8]);
+        m_code.emit(0x88); // mov [dst], al
+        m_code.mem(0, m_layout.m_r8[dstR8]);
+    } else if ((op & 0b1100'0111) == 0b0000'0110 && dstR8 != HL_ADDR) {
+        m_code.emit(0xC6); // mov byte [dst], u8
+        m_code.mem(0, m_layout.m_r8[dstR8]);
+        m_code.emit(u8);
+    } else if ((op & 0b1100'0110) == 0b0000'0100 && dstR8 != HL_ADDR) {
+        // INC r8 and DEC r8 keep the carry
+        const auto inc = (op & 1) == 0;
+        sync_flags();
+        m_code.emit(0x8A); // mov al, [r8]
+        m_code.mem(0, m_layout.m_r8[dstR8]);
+        m_code.emit(0xFE, inc ? 0xC0 : 0xC8); // inc al / dec al
+        store_flags(inc ? FlagOp::INC : FlagOp::DEC);
+        m_code.emit(0x88); // mov [r8], al
+        m_code.mem(0, m_layout.m_r8[dstR8]);
+    } else if ((op & 0b1100'1111) == 0b0000'0001) {
+        m_code.emit(0x66, 0xC7); // mov word [r16], u16
+        m_code.mem(0, m_layout.m_r16[r16]);
+        m_code.emit_imm(u16);
+    } else if ((op & 0b1100'0111) == 0b0000'0011) {
+        m_code.emit(0x66, 0xFF); // inc word [r16] / dec word [r16]
+        m_code.mem((op & 0b1000) ? 1 : 0, m_layout.m_r16[r16]);
+    } else if ((op & 0b1100'0000) == 0b1000'0000 && srcR8 != HL_ADDR) {
+        assemble_alu(dstR8, int8_t(srcR8), 0);
+    } else if ((op & 0b1100'0111) == 0b1100'0110) {
+        assemble_alu(dstR8, -1, u8);
+    } else if (op == +OpCode::JR_i8 || op == +OpCode::JP_a16) {
+        const auto target = op == +OpCode::JR_i8 ? uint16_t(nextPC + int8_t(u8)) : u16;
+        if (find_instr(target) >= 0) {
+            sync_flags(); // instructions of the block can be jumped to with F up to date only
+        }
+        end_instr(index, target, timing.m_cycles, true);
+        return true;
+    } else if ((op & 0b1110'0111) == 0b0010'0000 || (op & 0b1110'0111) == 0b1100'0010) {
+        // JR cc, i8 and JP cc, a16
+        const auto target = (op & 0b1100'0000) == 0 ? uint16_t(nextPC + int8_t(u8)) : u16;
+        const auto cond = Cond((op >> 3) & 0b11);
+        const auto flag = cond == Cond::NZ || cond == Cond::Z ? Flag::ZERO : Flag::CARRY;
+        sync_flags();
+        m_code.emit(0xF6); // test byte [f], flag
+        m_code.mem(0, m_layout.m_f);
+        m_code.emit(1 << +flag);
+        const auto notTaken = m_code.jcc(cond == Cond::NZ || cond == Cond::NC ? X86Cond::NE
+                                                                               : X86Cond::E);
+        end_instr(index, target, timing.m_cyclesIfBranch, true);
+        m_code.bind(notTaken);
+        end_instr(index, nextPC, timing.m_cycles, false);
+        return true;
+    } else {
+        return false;
+    }
+    end_instr(index, nextPC, timing.m_cycles, false);
+    return true;
+}
+
+void BlockAssembler::assemble_alu(int aluOp, int8_t r8, uint8_t u8) {
+    // ADD ADC SUB SBC AND XOR OR CP, as their x86 opcodes for al, r/m8
+    constexpr auto X86_OPS = std::array<uint8_t, 8>{0x02, 0x12, 0x2A, 0x1A, 0x22, 0x32, 0x0A, 0x3A};
+    constexpr auto FLAG_OPS = std::array<FlagOp, 8>{
+        FlagOp::ADD, FlagOp::ADC, FlagOp::SUB, FlagOp::SBC,
+        FlagOp::AND, FlagOp::XOR, FlagOp::OR,  FlagOp::SUB,
+    };
+    constexpr auto CP = 7;
+    const auto flagOp = FLAG_OPS[aluOp];
+    const auto carryIn = flagOp == FlagOp::ADC || flagOp == FlagOp::SBC;
+    if (carryIn) {
+        sync_flags();
+    }
+    m_code.emit(0x8A); // mov al, [a]
+    m_code.mem(0, m_layout.m_r8[+R8::A]);
+    if (carryIn) {
+        m_code.emit(0x8A); // mov dl, [f]
+        m_code.mem(2, m_layout.m_f);
+        m_code.emit(0xC0, 0xEA, 0x05); // shr dl, 5 - the carry flag into CF
+    }
+    if (r8 < 0) {
+        m_code.emit(X86_OPS[aluOp] + 2, u8); // op al, u8
+    } else {
+        m_code.emit(X86_OPS[aluOp]); // op al, [r8]
+        m_code.mem(0, m_layout.m_r8[r8]);
+    }
+    store_flags(flagOp);
+    if (aluOp != CP) {
+        m_code.emit(0x88); // mov [a], al
+        m_code.mem(0, m_layout.m_r8[+R8::A]);
+    }
+}
+
+void BlockAssembler::assemble_call(int index) {
+    const auto& instr = m_block.m_instrs[index];
+    const auto pc = m_pcs[index];
+    // what begin_block_instr does, m_slowWrite is already clear or the block would have stopped
+    m_code.emit(0x66, 0xC7); // mov word [pc], pc
+    m_code.mem(0, m_layout.m_pc);
+    m_code.emit_imm(pc);
+    m_code.emit(0x66, 0xC7); // mov word [blockPC], pc
+    m_code.mem(0, m_layout.m_blockPC);
+    m_code.emit_imm(pc);
+    m_code.emit(0xC7); // mov dword [blockIndex], index
+    m_code.mem(0, m_layout.m_blockIndex);
+    m_code.emit_imm(int32_t(index));
+    m_code.emit(0x48, 0x8B); // mov rax, [cpuCycle]
+    m_code.mem(0, m_layout.m_cpuCycle);
+    m_code.emit(0x48, 0x89); // mov [lastCpuCycle], rax
+    m_code.mem(0, m_layout.m_lastCpuCycle);
+    if (instr.m_prefixed) {
+        m_code.emit(0xC6); // mov byte [prefix], 0
+        m_code.mem(0, m_layout.m_prefix);
+        m_code.emit(0x00);
+    }
+
+    m_code.emit(0x48, 0x89, 0xDF); // mov rdi, rbx
+    m_code.emit(0xBE);             // mov esi, pcData
+    m_code.emit_imm(instr.m_pcData);
+    m_code.call(reinterpret_cast<uint64_t>(instr.m_handler));
+    m_code.emit(0x48, 0x89, 0xDF); // mov rdi, rbx
+    m_code.emit(0x48, 0x89, 0xC6); // mov rsi, rax - the InstructionResult
+    m_code.emit(0x4C, 0x89, 0xE2); // mov rdx, r12
+    m_code.emit(0xB9);             // mov ecx, size
+    m_code.emit_imm(uint32_t(instr.m_size));
+    m_code.call(reinterpret_cast<uint64_t>(m_endInstr));
+    m_code.emit(0x84, 0xC0); // test al, al
+    m_epilogueJumps.push_back(m_code.jcc(X86Cond::NE));
+    m_flagsSynced = false; // the handler may have left them lazy
+}
+
+// what end_block_instr does after an instruction that didn't touch memory
+void BlockAssembler::end_instr(int index, uint16_t newPC, int cycles, bool jumped) {
+    track_idle_loop(m_pcs[index], newPC, cycles);
+    m_code.emit(0x48, 0xFF); // inc qword [instructionCounter]
+    m_code.mem(0, m_layout.m_instructionCounter);
+    m_code.emit(0x48, 0x81); // add qword [cpuCycle], cycles
+    m_code.mem(0, m_layout.m_cpuCycle);
+    m_code.emit_imm(int32_t(cycles));
+
+    // a STOP carries on with the next instruction of the block next time, like next_block_instr
+    const auto resumeIndex = !jumped && index + 1 < int(m_pcs.size()) ? index + 1 : -1;
+    cmp_mem32(m_layout.m_idleLoopStart, newPC);
+    const auto idleLoop = m_code.jcc(X86Cond::E);
+    m_code.emit(0x48, 0x8B); // mov rax, [cpuCycle]
+    m_code.mem(0, m_layout.m_cpuCycle);
+    m_code.emit(0x48, 0x3B); // cmp rax, [syncCycle]
+    m_code.mem(0, m_layout.m_syncCycle);
+    m_exits.push_back({{idleLoop, m_code.jcc(X86Cond::GE)}, newPC, cycles, resumeIndex,
+                       CompiledStep::STOP});
+
+    if (resumeIndex >= 0) {
+        return; // falls through to the next instruction
+    }
+    const auto target = jumped ? find_instr(newPC) : -1;
+    if (target >= 0) {
+        m_links.emplace_back(m_code.jmp(), target);
+    } else {
+        m_exits.push_back({{m_code.jmp()}, newPC, cycles, -1, CompiledStep::JUMPED});
+    }
+}
+
+// Emulator::track_idle_loop with the PCs known. While no loop is watched m_branchCycles doesn't
+// matter, the backward branch that starts watching one sets it
+void BlockAssembler::track_idle_loop(uint16_t pc, uint16_t newPC, int cycles) {
+    constexpr auto MAX_LOOP_BYTES = 16; // Emulator::IdleLoop::MAX_LOOP_BYTES
+    cmp_mem32(m_layout.m_idleLoopStart, 0);
+    if (newPC >= pc || pc - newPC > MAX_LOOP_BYTES) {
+        const auto watching = m_code.jcc(X86Cond::GE);
+        m_idleLoopStubs.push_back({watching, m_code.size(), pc, cycles});
+        return;
+    }
+
+    const auto notWatching = m_code.jcc(X86Cond::L);
+    cmp_mem32(m_layout.m_idleLoopStart, pc);
+    const auto leftBefore = m_code.jcc(X86Cond::G);
+    cmp_mem32(m_layout.m_idleLoopEnd, pc);
+    const auto stayed = m_code.jcc(X86Cond::GE);
+    m_code.bind(leftBefore);
+    mov_mem32(m_layout.m_idleLoopStart, -1);
+    m_code.bind(notWatching);
+    m_code.bind(stayed);
+    cmp_mem32(m_layout.m_idleLoopStart, newPC);
+    const auto sameLoop = m_code.jcc(X86Cond::E);
+    mov_mem32(m_layout.m_idleLoopStart, newPC);
+    mov_mem32(m_layout.m_idleLoopEnd, pc);
+    m_code.emit(0x48, 0xC7); // mov qword [idleLoopCycle], -1
+    m_code.mem(0, m_layout.m_idleLoopCycle);
+    m_code.emit_imm(int32_t(-1));
+    m_code.bind(sameLoop);
+    cmp_mem32(m_layout.m_idleLoopEnd, pc);
+    const auto done = m_code.jcc(X86Cond::NE);
+    mov_mem32(m_layout.m_idleLoopBranchCycles, cycles);
+    m_code.bind(done);
+}
+
+// the rest of track_idle_loop for anything but a short backward branch, while a loop is watched
+void BlockAssembler::assemble_idle_loop_stub(const IdleLoopStub& stub) {
+    cmp_mem32(m_layout.m_idleLoopStart, stub.m_pc);
+    const auto leftBefore = m_code.jcc(X86Cond::G);
+    cmp_mem32(m_layout.m_idleLoopEnd, stub.m_pc);
+    const auto leftAfter = m_code.jcc(X86Cond::L);
+    m_code.patch_rel32(m_code.jcc(X86Cond::NE), stub.m_back);
+    mov_mem32(m_layout.m_idleLoopBranchCycles, stub.m_cycles);
+    m_code.patch_rel32(m_code.jmp(), stub.m_back);
+    m_code.bind(leftBefore);
+    m_code.bind(leftAfter);
+    mov_mem32(m_layout.m_idleLoopStart, -1);
+    m_code.patch_rel32(m_code.jmp(), stub.m_back);
+}
+
+void BlockAssembler::cmp_mem32(int32_t disp, int32_t value) {
+    m_code.emit(0x81); // cmp dword [disp], value
+    m_code.mem(7, disp);
+    m_code.emit_imm(value);
+}
+
+void BlockAssembler::mov_mem32(int32_t disp, int32_t value) {
+    m_code.emit(0xC7); // mov dword [disp], value
+    m_code.mem(0, disp);
+    m_code.emit_imm(value);
+}
+
+void BlockAssembler::sync_flags() {
+    if (m_flagsSynced) {
+        return;
+    }
+    m_code.emit(0x80); // cmp byte [flagOp], NONE
+    m_code.mem(7, m_layout.m_flagOp);
+    m_code.emit(+FlagOp::NONE);
+    const auto synced = m_code.jcc(X86Cond::E);
+    m_code.emit(0x48, 0x89, 0xDF); // mov rdi, rbx
+    m_code.call(reinterpret_cast<uint64_t>(m_layout.m_syncFlags));
+    m_code.bind(synced);
+    m_flagsSynced = true;
+}
+
+// F from the x86 flags of the op that just ran on al, which stays as it is. lahf puts ZF in bit 6,
+// AF (the half carry) in bit 4 and CF in bit 0 of ah
+void BlockAssembler::store_flags(FlagOp op) {
+    const auto logic = op == FlagOp::AND || op == FlagOp::XOR || op == FlagOp::OR;
+    m_code.emit(0x9F);             // lahf
+    m_code.emit(0x0F, 0xB6, 0xCC); // movzx ecx, ah
+    m_code.emit(0x89, 0xCA);       // mov edx, ecx
+    m_code.emit(0x83, 0xE2, logic ? 0x40 : 0x50); // and edx, ZF (| AF)
+    m_code.emit(0x01, 0xD2);       // add edx, edx - Z and H
+    if (op == FlagOp::INC || op == FlagOp::DEC) {
+        m_code.emit(0x0F, 0xB6); // movzx ecx, byte [f]
+        m_code.mem(1, m_layout.m_f);
+        m_code.emit(0x83, 0xE1, 1 << +Flag::CARRY); // and ecx, C
+        m_code.emit(0x09, 0xCA);                    // or edx, ecx
+    } else if (!logic) {
+        m_code.emit(0x83, 0xE1, 0x01); // and ecx, CF
+        m_code.emit(0xC1, 0xE1, +Flag::CARRY); // shl ecx, 4 - C
+        m_code.emit(0x09, 0xCA); // or edx, ecx
+    }
+    const auto negative = op == FlagOp::SUB || op == FlagOp::SBC || op == FlagOp::DEC;
+    const auto constBits = uint8_t((negative ? 1 << +Flag::NEGATIVE : 0) |
+                                   (op == FlagOp::AND ? 1 << +Flag::HALF_CARRY : 0));
+    if (constBits != 0) {
+        m_code.emit(0x83, 0xCA, constBits); // or edx, N / H
+    }
+    m_code.emit(0x88); // mov [f], dl
+    m_code.mem(2, m_layout.m_f);
+    if (!m_flagsSynced) {
+        m_code.emit(0xC6); // mov byte [flagOp], NONE
+        m_code.mem(0, m_layout.m_flagOp);
+        m_code.emit(+FlagOp::NONE);
+        m_flagsSynced = true;
+    }
+}
+
+int BlockAssembler::find_instr(uint16_t pc) const {
+    for (int i = 0; i < int(m_pcs.size()); ++i) {
+        // the second half of a CB instruction isn't one on its own
+        if (m_pcs[i] == pc && !m_block.m_instrs[i].m_prefixed) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+#endif
+
+} // namespace
+
+Jit::Jit(EndInstrFn endInstr, const Layout& layout)
+    : m_endInstr(endInstr)
+    , m_layout(layout) {
+}
+
+Jit::BlockFn Jit::compile(const Block& block) {
+#if EZ_JIT_X64
+    if (!m_code && !m_mapFailed) {
+        // never writable and executable at the same time, compile flips the pages it writes
+        auto* const code = mmap(nullptr, CODE_BYTES, PROT_READ | PROT_EXEC,
+                                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (code == MAP_FAILED) {
+            log_warn("Couldn't map {} bytes for the JIT, blocks stay in the block cache",
+                     CODE_BYTES);
+            m_mapFailed = true;
+        } else {
+            m_code.reset(static_cast<uint8_t*>(code));
+        }
+    }
+    if (!m_code || block.m_instrs.empty()) {
+        return nullptr;
+    }
+
+    auto assembler = BlockAssembler(block, m_layout, m_endInstr);
+    const auto blockCode = assembler.assemble();
+    const auto offset = (m_usedBytes + BLOCK_ALIGN - 1) / BLOCK_ALIGN * BLOCK_ALIGN;
+    if (offset + blockCode.size() > CODE_BYTES) {
+        return nullptr;
+    }
+    const auto pageBytes = size_t(sysconf(_SC_PAGESIZE));
+    const auto firstPage = offset / pageBytes * pageBytes;
+    const auto pagesBytes = offset + blockCode.size() - firstPage;
+    auto* const pages = m_code.get() + firstPage;
+    if (mprotect(pages, pagesBytes, PROT_READ | PROT_WRITE) != 0) {
+        log_error("Couldn't make JIT code writable");
+        return nullptr;
+    }
+    memcpy(m_code.get() + offset, blockCode.data(), blockCode.size());
+    if (mprotect(pages, pagesBytes, PROT_READ | PROT_EXEC) != 0) {
+        log_error("Couldn't make JIT code executable");
+        return nullptr;
+    }
+    m_usedBytes = offset + blockCode.size();
+    ++m_blockCount;
+    m_inlineInstrs += assembler.get_inline_instrs();
+    return reinterpret_cast<BlockFn>(m_code.get() + offset);
+#else
+    (void)block;
+    (void)m_endInstr;
+    (void)m_layout;
+    (void)m_mapFailed;
+    return nullptr;
+#endif
+}
+
+void Jit::clear() {
+    m_usedBytes = 0;
+    m_blockCount = 0;
+    m_inlineInstrs = 0;
+}
+
+void Jit::CodeDeleter::operator()(uint8_t* code) const {
+#if EZ_JIT_X64
+    munmap(code, CODE_BYTES);
+#else
+    (void)code;
+#endif
+}
+
+} // namespace ez
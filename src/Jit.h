@@ -0,0 +1,89 @@
+#pragma once
+#include "Base.h"
+#include "Recompiler.h"
+
+// the generated code follows the System V calling convention
+#if defined(__x86_64__) && !defined(_WIN32)
+    #define EZ_JIT_X64 1
+#else
+    #define EZ_JIT_X64 0
+#endif
+
+namespace ez {
+
+class Emulator;
+struct Block;
+struct InstructionResult;
+
+// Native code for hot cached blocks, CpuDispatch::JIT. Register loads, 8-bit ALU ops, INC/DEC and
+// relative or absolute jumps, conditional or not, are translated to x86-64 that works on the
+// emulator's registers in place, writes F straight away instead of leaving the flags lazy, and
+// counts cycles, tracks idle loops and checks for sync points itself. Branches to an instruction of
+// the same block jump there without leaving the native code. Every other instruction becomes a
+// call to its handler with the pcData baked in, then a call to the end function, which does what
+// run_blocks does between two instructions and says whether the next one can follow. A write that
+// drops the running block leaves the native code after that instruction. Only x86-64 hosts have a
+// backend, compile fails everywhere else and the blocks keep running through the block cache
+class Jit {
+  public:
+    // startIndex is the instruction to start at, the CPU can stop in the middle of a block
+    using BlockFn = CompiledStep (*)(Emulator& emu, int64_t untilCycle, int startIndex);
+    // NEXT if the next instruction of the block can run straight away
+    using EndInstrFn = CompiledStep (*)(Emulator& emu, InstructionResult result,
+                                        int64_t untilCycle, uint32_t size);
+
+    using SyncFlagsFn = void (*)(Emulator& emu);
+
+    // where the translated instructions find the emulator state, offsets from the Emulator
+    struct Layout {
+        std::array<int32_t, 8> m_r8{};  // by R8, HL_ADDR is never used
+        std::array<int32_t, 4> m_r16{}; // by R16
+        int32_t m_pc = 0;
+        int32_t m_f = 0;
+        int32_t m_flagOp = 0; // LazyFlags::m_op
+        int32_t m_prefix = 0;
+        int32_t m_cpuCycle = 0;
+        int32_t m_lastCpuCycle = 0;
+        int32_t m_syncCycle = 0; // the sync point the native code stops at
+        int32_t m_instructionCounter = 0;
+        int32_t m_idleLoopStart = 0;
+        int32_t m_idleLoopEnd = 0;
+        int32_t m_idleLoopBranchCycles = 0;
+        int32_t m_idleLoopCycle = 0;
+        int32_t m_block = 0;
+        int32_t m_blockIndex = 0;
+        int32_t m_blockPC = 0;
+        SyncFlagsFn m_syncFlags = nullptr; // before reading F while the flags may be lazy
+    };
+
+    static constexpr bool SUPPORTED = EZ_JIT_X64;
+    static constexpr int HOT_RUNS = 16; // times a block is entered before it's compiled
+    static constexpr size_t CODE_BYTES = 4 * 1024 * 1024;
+
+    // the native code is entered with F up to date and Layout::m_syncCycle set for untilCycle
+    Jit(EndInstrFn endInstr, const Layout& layout);
+
+    // nullptr if the code buffer is full or there's no backend
+    BlockFn compile(const Block& block);
+    // frees the code of every block compiled so far, none of them can be called afterwards
+    void clear();
+
+    size_t get_code_bytes() const { return m_usedBytes; }
+    int get_block_count() const { return m_blockCount; }
+    int64_t get_inline_instr_count() const { return m_inlineInstrs; } // compiled without a call
+
+  private:
+    struct CodeDeleter {
+        void operator()(uint8_t* code) const;
+    };
+
+    EndInstrFn m_endInstr = nullptr;
+    Layout m_layout;
+    std::unique_ptr<uint8_t[], CodeDeleter> m_code; // CODE_BYTES, mapped by the first compile
+    size_t m_usedBytes = 0;
+    int m_blockCount = 0;
+    int64_t m_inlineInstrs = 0;
+    bool m_mapFailed = false;
+};
+
+} // namespace ez
@@ -0,0 +1,244 @@
+#include "Logger.h"
+
+#include <filesystem>
+#include <iostream>
+
+namespace ez {
+
+namespace {
+
+constexpr auto RATE_LIMIT_WINDOW = std::chrono::nanoseconds(std::chrono::seconds(1)).count();
+constexpr auto WRITER_IDLE_SLEEP = std::chrono::milliseconds(1);
+constexpr auto MAX_SITE_PROBES = 16;
+
+int64_t steady_nanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+} // namespace
+
+const char* to_string(LogLevel level) {
+
+    switch (level) {
+        case LogLevel::INFO:     return "\33[0;32m[INFO]\33[0m";
+        case LogLevel::WARN:     return "\33[0;33m[WARN]\33[0m";
+        case LogLevel::ERROR:    return "\33[0;31m[ERROR]\33[0m";
+        case LogLevel::CRITICAL: return "\33[0;31m[CRITICAL]\33[0m";
+    }
+    abort();
+
+}
+
+static auto as_local(const std::chrono::system_clock::time_point& tp) {
+    #if EZ_CLANG
+    // todo, enable this whenever clang gets zoned_time
+    return tp;
+    #else
+    return std::chrono::zoned_time{std::chrono::current_zone(), tp};
+    #endif
+}
+
+std::string to_string(const std::chrono::system_clock::time_point& tp) {
+    return std::format("{:%T}", as_local(tp));
+}
+
+std::string to_string(const std::source_location& source) {
+    return std::format("{}:{} {}", std::filesystem::path(source.file_name()).filename().string(),
+                       source.line(), source.function_name());
+}
+
+Logger& Logger::get() {
+    static auto logger = Logger{};
+    return logger;
+}
+
+Logger::Logger() {
+    for (size_t i = 0; i < CAPACITY; ++i) {
+        m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+    }
+#if !EZ_WASM
+    // the browser build has no threads, it writes on the spot
+    m_threaded = true;
+    m_writer = std::thread([this] { run_writer(); });
+#endif
+}
+
+Logger::~Logger() {
+    if (m_writer.joinable()) {
+        m_stop.store(true, std::memory_order_release);
+        wake_writer();
+        m_writer.join();
+    }
+    // anything logged from here on is written straight away
+    m_threaded = false;
+    drain();
+}
+
+bool Logger::admit(const std::source_location& location, int& suppressed) {
+    suppressed = 0;
+    const auto key =
+        (uint64_t(uintptr_t(location.file_name())) * 0x9E3779B97F4A7C15ull ^ location.line()) | 1;
+    Site* site = nullptr;
+    for (auto probe = 0; probe < MAX_SITE_PROBES && !site; ++probe) {
+        auto& candidate = m_sites[(key + probe) % MAX_LOG_SITES];
+        auto existing = candidate.m_key.load(std::memory_order_acquire);
+        if (existing == 0 && candidate.m_key.compare_exchange_strong(existing, key)) {
+            candidate.m_file.store(location.file_name(), std::memory_order_relaxed);
+            candidate.m_line.store(location.line(), std::memory_order_relaxed);
+            existing = key;
+        }
+        if (existing == key) {
+            site = &candidate;
+        }
+    }
+    if (!site) {
+        return true;
+    }
+
+    const auto now = steady_nanoseconds();
+    auto windowStart = site->m_windowStart.load(std::memory_order_relaxed);
+    if (now - windowStart >= RATE_LIMIT_WINDOW &&
+        site->m_windowStart.compare_exchange_strong(windowStart, now)) {
+        site->m_count.store(0, std::memory_order_relaxed);
+    }
+    if (site->m_count.fetch_add(1, std::memory_order_relaxed) >= LOG_SITE_BURST) {
+        site->m_suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    suppressed = site->m_suppressed.exchange(0, std::memory_order_relaxed);
+    return true;
+}
+
+Logger::Slot* Logger::begin_push() {
+    auto pos = m_head.load(std::memory_order_relaxed);
+    while (true) {
+        auto& slot = m_slots[pos % CAPACITY];
+        const auto sequence = slot.m_sequence.load(std::memory_order_acquire);
+        if (sequence == pos) {
+            if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                return &slot;
+            }
+        } else if (sequence < pos) {
+            // the writer hasn't got to the record a lap behind yet
+            return nullptr;
+        } else {
+            pos = m_head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void Logger::wait_for_writer() {
+    if (!m_threaded.load(std::memory_order_relaxed)) {
+        drain();
+    } else {
+        std::this_thread::yield();
+    }
+}
+
+void Logger::end_push(Slot* slot) {
+    const auto pos = slot->m_sequence.load(std::memory_order_relaxed);
+    slot->m_sequence.store(pos + 1, std::memory_order_release);
+    if (!m_threaded.load(std::memory_order_relaxed)) {
+        drain();
+    }
+}
+
+void Logger::flush() {
+    const auto target = m_head.load(std::memory_order_acquire);
+    if (m_written.load(std::memory_order_acquire) < target && m_threaded) {
+        wake_writer();
+    }
+    while (m_written.load(std::memory_order_acquire) < target) {
+        wait_for_writer();
+    }
+    std::cout.flush();
+}
+
+size_t Logger::drain() {
+    size_t count = 0;
+    while (true) {
+        const auto pos = m_written.load(std::memory_order_relaxed);
+        auto& slot = m_slots[pos % CAPACITY];
+        if (slot.m_sequence.load(std::memory_order_acquire) != pos + 1) {
+            break;
+        }
+        write(slot.m_record);
+        slot.m_sequence.store(pos + CAPACITY, std::memory_order_release);
+        m_written.store(pos + 1, std::memory_order_release);
+        ++count;
+    }
+    if (const auto dropped = m_dropped.exchange(0, std::memory_order_relaxed)) {
+        write_line(LogLevel::WARN, std::chrono::system_clock::now(),
+                   std::format("logger | {} messages dropped, the ring buffer was full", dropped));
+    }
+    return count;
+}
+
+void Logger::run_writer() {
+    auto lastSweep = steady_nanoseconds();
+    while (true) {
+        const auto stopping = m_stop.load(std::memory_order_acquire);
+        const auto wrote = drain();
+        if (const auto now = steady_nanoseconds(); now - lastSweep >= RATE_LIMIT_WINDOW) {
+            report_suppressed(false);
+            lastSweep = now;
+        }
+        if (wrote == 0) {
+            if (stopping) {
+                break;
+            }
+            auto lock = std::unique_lock(m_wakeMutex);
+            m_wake.wait_for(lock, WRITER_IDLE_SLEEP, [this] { return m_wakeRequested; });
+            m_wakeRequested = false;
+        }
+    }
+    report_suppressed(true);
+}
+
+void Logger::wake_writer() {
+    {
+        const auto lock = std::lock_guard(m_wakeMutex);
+        m_wakeRequested = true;
+    }
+    m_wake.notify_one();
+}
+
+void Logger::write(LogRecord& record) {
+    auto text = record.m_formatArgs ? record.m_formatArgs(record.m_format, record.m_args.data())
+                                    : std::move(record.m_text);
+    if (record.m_suppressed > 0) {
+        text += std::format(" ({} similar suppressed)", record.m_suppressed);
+    }
+    write_line(record.m_level, record.m_time,
+               std::format("{} | {}", to_string(record.m_location), text));
+    record.m_text.clear();
+}
+
+void Logger::write_line(LogLevel level, const std::chrono::system_clock::time_point& time,
+                        std::string_view text) {
+    std::cout << std::format("{} {} {}\n", to_string(level), to_string(time), text);
+    if (level == LogLevel::CRITICAL || level == LogLevel::ERROR) {
+        std::cout.flush();
+    }
+}
+
+void Logger::report_suppressed(bool all) {
+    const auto now = steady_nanoseconds();
+    for (auto& site : m_sites) {
+        const auto file = site.m_file.load(std::memory_order_relaxed);
+        if (!file || site.m_suppressed.load(std::memory_order_relaxed) == 0 ||
+            (!all && now - site.m_windowStart.load(std::memory_order_relaxed) < RATE_LIMIT_WINDOW)) {
+            continue;
+        }
+        if (const auto suppressed = site.m_suppressed.exchange(0, std::memory_order_relaxed)) {
+            write_line(LogLevel::WARN, std::chrono::system_clock::now(),
+                       std::format("{}:{} | {} similar suppressed",
+                                   std::filesystem::path(file).filename().string(),
+                                   site.m_line.load(std::memory_order_relaxed), suppressed));
+        }
+    }
+}
+
+} // namespace ez
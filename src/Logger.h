@@ -0,0 +1,175 @@
+#pragma once
+
+#include "Platform.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <format>
+#include <mutex>
+#include <new>
+#include <source_location>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+
+// messages below this level compile to nothing: 0 INFO, 1 WARN, 2 ERROR. CRITICAL always logs
+#ifndef EZ_LOG_MIN_LEVEL
+    #define EZ_LOG_MIN_LEVEL 0
+#endif
+
+namespace ez {
+
+enum class LogLevel {
+    INFO,
+    WARN,
+    ERROR,
+    CRITICAL
+};
+
+const char* to_string(LogLevel level);
+std::string to_string(const std::chrono::system_clock::time_point& tp);
+std::string to_string(const std::source_location& source);
+
+inline constexpr bool is_log_level_enabled(LogLevel level) {
+    return level == LogLevel::CRITICAL || int(level) >= EZ_LOG_MIN_LEVEL;
+}
+
+// Numbers and enums are stored as they are and only formatted on the writer thread. Anything else
+// might point at something that doesn't outlive the call (pointers, string_view, span, a struct
+// holding either...), so it's formatted on the spot instead, as is anything too big to fit
+template <typename T>
+concept DeferrableLogArg = std::is_arithmetic_v<T> || std::is_enum_v<T>;
+
+struct LogRecord {
+    static constexpr size_t ARG_BYTES = 48;
+
+    LogLevel m_level = LogLevel::INFO;
+    std::chrono::system_clock::time_point m_time{};
+    std::source_location m_location{};
+    int m_suppressed = 0;     // messages from the same call site the rate limit dropped before it
+    std::string_view m_format; // always a literal
+    std::string (*m_formatArgs)(std::string_view, const std::byte*) = nullptr;
+    alignas(std::max_align_t) std::array<std::byte, ARG_BYTES> m_args{};
+    std::string m_text; // already formatted, when m_formatArgs is null
+};
+
+// Lock-free multi-producer ring buffer drained by a writer thread. Logging from the emulator never
+// blocks or allocates for arguments that can be deferred, and when the ring is full the message is
+// dropped and counted instead. Errors and criticals, usually the last thing before an abort, are
+// written straight from the calling thread then. Each call site gets LOG_SITE_BURST messages a
+// second, the rest are counted and reported with its next message or once the second is up.
+// log_verbose, for output the user turned on and wants all of, skips the limit and waits for room
+// instead of dropping
+class Logger {
+    friend class Tester;
+
+  public:
+    static constexpr size_t CAPACITY = 1024; // records, a power of two
+    static constexpr int LOG_SITE_BURST = 10;
+    static constexpr int MAX_LOG_SITES = 1024; // more than this and the extra ones aren't limited
+
+    static Logger& get();
+    ~Logger();
+
+    // false if the call site is over its rate limit, otherwise suppressed is how many it dropped
+    bool admit(const std::source_location& location, int& suppressed);
+
+    // wait blocks while the ring is full rather than dropping the message
+    template <typename... TArgs>
+    void push(LogLevel level, const std::source_location& location, int suppressed, bool wait,
+              std::string_view format, const TArgs&... args) {
+        auto* slot = begin_push();
+        for (; !slot && wait; slot = begin_push()) {
+            wait_for_writer();
+        }
+        // errors are usually the last thing before an abort, rather than drop one it's written
+        // from this thread
+        if (!slot && level < LogLevel::ERROR) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        auto unqueued = LogRecord{};
+        auto& record = slot ? slot->m_record : unqueued;
+        record.m_level = level;
+        record.m_time = std::chrono::system_clock::now();
+        record.m_location = location;
+        record.m_suppressed = suppressed;
+        using Tuple = std::tuple<std::decay_t<TArgs>...>;
+        if constexpr ((DeferrableLogArg<std::decay_t<TArgs>> && ...) &&
+                      sizeof(Tuple) <= LogRecord::ARG_BYTES &&
+                      alignof(Tuple) <= alignof(std::max_align_t)) {
+            record.m_format = format;
+            record.m_formatArgs = &format_args<Tuple>;
+            new (record.m_args.data()) Tuple(args...);
+        } else {
+            record.m_formatArgs = nullptr;
+            record.m_text = std::vformat(format, std::make_format_args(args...));
+        }
+        if (slot) {
+            end_push(slot);
+        } else {
+            write(record);
+        }
+    }
+
+    // blocks until everything logged so far has been written, waking the writer if it's idle
+    void flush();
+
+  private:
+    struct Slot {
+        std::atomic<size_t> m_sequence = 0;
+        LogRecord m_record;
+    };
+
+    struct Site {
+        std::atomic<uint64_t> m_key = 0; // 0 while free
+        std::atomic<const char*> m_file = nullptr;
+        std::atomic<uint32_t> m_line = 0;
+        std::atomic<int64_t> m_windowStart = 0; // steady_clock nanoseconds
+        std::atomic<int> m_count = 0;
+        std::atomic<int> m_suppressed = 0;
+    };
+
+    Logger();
+
+    template <typename TTuple>
+    static std::string format_args(std::string_view format, const std::byte* bytes) {
+        const auto& args = *std::launder(reinterpret_cast<const TTuple*>(bytes));
+        return std::apply(
+            [&](const auto&... unpacked) {
+                return std::vformat(format, std::make_format_args(unpacked...));
+            },
+            args);
+    }
+
+    Slot* begin_push(); // nullptr if the ring is full
+    void wait_for_writer(); // until it's made some room
+    void end_push(Slot* slot);
+    void run_writer();
+    void wake_writer(); // out of its idle sleep
+    size_t drain(); // writes every record that's ready, returns how many
+    void write(LogRecord& record);
+    void write_line(LogLevel level, const std::chrono::system_clock::time_point& time,
+                    std::string_view text);
+    void report_suppressed(bool all); // for sites that haven't logged since going over the limit
+
+    std::array<Slot, CAPACITY> m_slots;
+    std::array<Site, MAX_LOG_SITES> m_sites;
+    alignas(64) std::atomic<size_t> m_head = 0; // next slot a producer claims
+    alignas(64) std::atomic<size_t> m_written = 0; // records the writer has finished with
+    std::atomic<int64_t> m_dropped = 0;
+    std::atomic<bool> m_stop = false;
+    std::atomic<bool> m_threaded = false;
+    std::thread m_writer;
+    std::mutex m_wakeMutex;
+    std::condition_variable m_wake; // cuts the writer's idle sleep short for a flush
+    bool m_wakeRequested = false;   // under m_wakeMutex
+};
+
+} // namespace ez
@@ -49,6 +49,15 @@ inline constexpr bool is_tima_increment(uint16_t sysclkBefore, uint16_t sysclkAf
     return bitSetBefore && !bitSetAfter;
 }
 
+// T-cycles between TIMA increments for the clock selected by TAC
+inline constexpr int get_tima_period(uint8_t tac) {
+    const auto timaControlBits = 0b11 & tac;
+    return timaControlBits == 0b00   ? 1024
+           : timaControlBits == 0b11 ? 256
+           : timaControlBits == 0b10 ? 64
+                                     : 16;
+}
+
 inline constexpr uint8_t sample_palette(uint8_t paletteIdx, uint8_t palette) {
     ez_assert(paletteIdx < 4);
     return ((0b11 << (2 * paletteIdx)) & palette) >> (2 * paletteIdx);
@@ -8,7 +8,7 @@
 
 namespace ez {
 
-    enum class FlagEffect {
+    enum class FlagEffect : uint8_t {
         NONE,
         UNSET,
         SET,
@@ -18,6 +18,25 @@ namespace ez {
         SUBTRACTION,
     };
 
+    // hot fields, looked up by the CPU on every instruction
+    struct OpCodeTiming {
+        uint8_t m_size = 0;
+        uint8_t m_cycles = 0;
+        uint8_t m_cyclesIfBranch = 0; // 0 if the instruction never branches
+    };
+
+    // cold fields, only needed for logging and the debugger
+    struct OpCodeDetails {
+        const char* m_mnemonic = "";
+        const char* m_operandName1 = "";
+        const char* m_operandName2 = "";
+        FlagEffect m_flagZero = FlagEffect::NONE;
+        FlagEffect m_flagSubtract = FlagEffect::NONE;
+        FlagEffect m_flagHalfCarry = FlagEffect::NONE;
+        FlagEffect m_flagCarry = FlagEffect::NONE;
+    };
+
+    // everything about an opcode, assembled from the tables above
     struct OpCodeInfo {
         bool m_prefixed = false;
         uint8_t m_addr = 0x00;
@@ -553,7703 +572,1071 @@ namespace ez {
     };
 
 
-    inline OpCodeInfo get_opcode_info(uint8_t code) {
-
-        switch(code){
-
-        case 0x00:
-            return {false, 
-                    0x00, 
-                    "NOP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0x01:
-            return {false, 
-                    0x01, 
-                    "LD",
-                    3,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "BC",
-                    "u16",
-                   };
-
-        case 0x02:
-            return {false, 
-                    0x02, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(BC)",
-                    "A",
-                   };
-
-        case 0x03:
-            return {false, 
-                    0x03, 
-                    "INC",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "BC",
-                    "",
-                   };
-
-        case 0x04:
-            return {false, 
-                    0x04, 
-                    "INC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "B",
-                    "",
-                   };
-
-        case 0x05:
-            return {false, 
-                    0x05, 
-                    "DEC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "B",
-                    "",
-                   };
-
-        case 0x06:
-            return {false, 
-                    0x06, 
-                    "LD",
-                    2,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "B",
-                    "u8",
-                   };
-
-        case 0x07:
-            return {false, 
-                    0x07, 
-                    "RLCA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "",
-                    "",
-                   };
-
-        case 0x08:
-            return {false, 
-                    0x08, 
-                    "LD",
-                    3,
-                    20,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(a16)",
-                    "SP",
-                   };
-
-        case 0x09:
-            return {false, 
-                    0x09, 
-                    "ADD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "HL",
-                    "BC",
-                   };
-
-        case 0x0A:
-            return {false, 
-                    0x0A, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "(BC)",
-                   };
-
-        case 0x0B:
-            return {false, 
-                    0x0B, 
-                    "DEC",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "BC",
-                    "",
-                   };
-
-        case 0x0C:
-            return {false, 
-                    0x0C, 
-                    "INC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "C",
-                    "",
-                   };
-
-        case 0x0D:
-            return {false, 
-                    0x0D, 
-                    "DEC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "C",
-                    "",
-                   };
-
-        case 0x0E:
-            return {false, 
-                    0x0E, 
-                    "LD",
-                    2,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "C",
-                    "u8",
-                   };
-
-        case 0x0F:
-            return {false, 
-                    0x0F, 
-                    "RRCA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "",
-                    "",
-                   };
-
-        case 0x10:
-            return {false, 
-                    0x10, 
-                    "STOP",
-                    2,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "u8",
-                    "",
-                   };
-
-        case 0x11:
-            return {false, 
-                    0x11, 
-                    "LD",
-                    3,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "DE",
-                    "u16",
-                   };
-
-        case 0x12:
-            return {false, 
-                    0x12, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(DE)",
-                    "A",
-                   };
-
-        case 0x13:
-            return {false, 
-                    0x13, 
-                    "INC",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "DE",
-                    "",
-                   };
-
-        case 0x14:
-            return {false, 
-                    0x14, 
-                    "INC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "D",
-                    "",
-                   };
-
-        case 0x15:
-            return {false, 
-                    0x15, 
-                    "DEC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "D",
-                    "",
-                   };
-
-        case 0x16:
-            return {false, 
-                    0x16, 
-                    "LD",
-                    2,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "D",
-                    "u8",
-                   };
-
-        case 0x17:
-            return {false, 
-                    0x17, 
-                    "RLA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "",
-                    "",
-                   };
-
-        case 0x18:
-            return {false, 
-                    0x18, 
-                    "JR",
-                    2,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "i8",
-                    "",
-                   };
-
-        case 0x19:
-            return {false, 
-                    0x19, 
-                    "ADD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "HL",
-                    "DE",
-                   };
-
-        case 0x1A:
-            return {false, 
-                    0x1A, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "(DE)",
-                   };
-
-        case 0x1B:
-            return {false, 
-                    0x1B, 
-                    "DEC",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "DE",
-                    "",
-                   };
-
-        case 0x1C:
-            return {false, 
-                    0x1C, 
-                    "INC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "E",
-                    "",
-                   };
-
-        case 0x1D:
-            return {false, 
-                    0x1D, 
-                    "DEC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "E",
-                    "",
-                   };
-
-        case 0x1E:
-            return {false, 
-                    0x1E, 
-                    "LD",
-                    2,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "E",
-                    "u8",
-                   };
-
-        case 0x1F:
-            return {false, 
-                    0x1F, 
-                    "RRA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "",
-                    "",
-                   };
-
-        case 0x20:
-            return {false, 
-                    0x20, 
-                    "JR",
-                    2,
-                    12,
-                    8,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "NZ",
-                    "i8",
-                   };
-
-        case 0x21:
-            return {false, 
-                    0x21, 
-                    "LD",
-                    3,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "HL",
-                    "u16",
-                   };
-
-        case 0x22:
-            return {false, 
-                    0x22, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(HL+)",
-                    "A",
-                   };
-
-        case 0x23:
-            return {false, 
-                    0x23, 
-                    "INC",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "HL",
-                    "",
-                   };
-
-        case 0x24:
-            return {false, 
-                    0x24, 
-                    "INC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "H",
-                    "",
-                   };
-
-        case 0x25:
-            return {false, 
-                    0x25, 
-                    "DEC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "H",
-                    "",
-                   };
-
-        case 0x26:
-            return {false, 
-                    0x26, 
-                    "LD",
-                    2,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "H",
-                    "u8",
-                   };
-
-        case 0x27:
-            return {false, 
-                    0x27, 
-                    "DAA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::NONE,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "",
-                    "",
-                   };
-
-        case 0x28:
-            return {false, 
-                    0x28, 
-                    "JR",
-                    2,
-                    12,
-                    8,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "Z",
-                    "i8",
-                   };
-
-        case 0x29:
-            return {false, 
-                    0x29, 
-                    "ADD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "HL",
-                    "HL",
-                   };
-
-        case 0x2A:
-            return {false, 
-                    0x2A, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "(HL+)",
-                   };
-
-        case 0x2B:
-            return {false, 
-                    0x2B, 
-                    "DEC",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "HL",
-                    "",
-                   };
-
-        case 0x2C:
-            return {false, 
-                    0x2C, 
-                    "INC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "L",
-                    "",
-                   };
-
-        case 0x2D:
-            return {false, 
-                    0x2D, 
-                    "DEC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "L",
-                    "",
-                   };
-
-        case 0x2E:
-            return {false, 
-                    0x2E, 
-                    "LD",
-                    2,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "L",
-                    "u8",
-                   };
-
-        case 0x2F:
-            return {false, 
-                    0x2F, 
-                    "CPL",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::SET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0x30:
-            return {false, 
-                    0x30, 
-                    "JR",
-                    2,
-                    12,
-                    8,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "NC",
-                    "i8",
-                   };
-
-        case 0x31:
-            return {false, 
-                    0x31, 
-                    "LD",
-                    3,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "SP",
-                    "u16",
-                   };
-
-        case 0x32:
-            return {false, 
-                    0x32, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(HL-)",
-                    "A",
-                   };
-
-        case 0x33:
-            return {false, 
-                    0x33, 
-                    "INC",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "SP",
-                    "",
-                   };
-
-        case 0x34:
-            return {false, 
-                    0x34, 
-                    "INC",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "(HL)",
-                    "",
-                   };
-
-        case 0x35:
-            return {false, 
-                    0x35, 
-                    "DEC",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "(HL)",
-                    "",
-                   };
-
-        case 0x36:
-            return {false, 
-                    0x36, 
-                    "LD",
-                    2,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(HL)",
-                    "u8",
-                   };
-
-        case 0x37:
-            return {false, 
-                    0x37, 
-                    "SCF",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    "",
-                    "",
-                   };
-
-        case 0x38:
-            return {false, 
-                    0x38, 
-                    "JR",
-                    2,
-                    12,
-                    8,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "C",
-                    "i8",
-                   };
-
-        case 0x39:
-            return {false, 
-                    0x39, 
-                    "ADD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "HL",
-                    "SP",
-                   };
-
-        case 0x3A:
-            return {false, 
-                    0x3A, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "(HL-)",
-                   };
-
-        case 0x3B:
-            return {false, 
-                    0x3B, 
-                    "DEC",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "SP",
-                    "",
-                   };
-
-        case 0x3C:
-            return {false, 
-                    0x3C, 
-                    "INC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "A",
-                    "",
-                   };
-
-        case 0x3D:
-            return {false, 
-                    0x3D, 
-                    "DEC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "A",
-                    "",
-                   };
-
-        case 0x3E:
-            return {false, 
-                    0x3E, 
-                    "LD",
-                    2,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "u8",
-                   };
-
-        case 0x3F:
-            return {false, 
-                    0x3F, 
-                    "CCF",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "",
-                    "",
-                   };
-
-        case 0x40:
-            return {false, 
-                    0x40, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "B",
-                    "B",
-                   };
-
-        case 0x41:
-            return {false, 
-                    0x41, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "B",
-                    "C",
-                   };
-
-        case 0x42:
-            return {false, 
-                    0x42, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "B",
-                    "D",
-                   };
-
-        case 0x43:
-            return {false, 
-                    0x43, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "B",
-                    "E",
-                   };
-
-        case 0x44:
-            return {false, 
-                    0x44, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "B",
-                    "H",
-                   };
-
-        case 0x45:
-            return {false, 
-                    0x45, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "B",
-                    "L",
-                   };
-
-        case 0x46:
-            return {false, 
-                    0x46, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "B",
-                    "(HL)",
-                   };
-
-        case 0x47:
-            return {false, 
-                    0x47, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "B",
-                    "A",
-                   };
-
-        case 0x48:
-            return {false, 
-                    0x48, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "C",
-                    "B",
-                   };
-
-        case 0x49:
-            return {false, 
-                    0x49, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "C",
-                    "C",
-                   };
-
-        case 0x4A:
-            return {false, 
-                    0x4A, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "C",
-                    "D",
-                   };
-
-        case 0x4B:
-            return {false, 
-                    0x4B, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "C",
-                    "E",
-                   };
-
-        case 0x4C:
-            return {false, 
-                    0x4C, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "C",
-                    "H",
-                   };
-
-        case 0x4D:
-            return {false, 
-                    0x4D, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "C",
-                    "L",
-                   };
-
-        case 0x4E:
-            return {false, 
-                    0x4E, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "C",
-                    "(HL)",
-                   };
-
-        case 0x4F:
-            return {false, 
-                    0x4F, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "C",
-                    "A",
-                   };
-
-        case 0x50:
-            return {false, 
-                    0x50, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "D",
-                    "B",
-                   };
-
-        case 0x51:
-            return {false, 
-                    0x51, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "D",
-                    "C",
-                   };
-
-        case 0x52:
-            return {false, 
-                    0x52, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "D",
-                    "D",
-                   };
-
-        case 0x53:
-            return {false, 
-                    0x53, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "D",
-                    "E",
-                   };
-
-        case 0x54:
-            return {false, 
-                    0x54, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "D",
-                    "H",
-                   };
-
-        case 0x55:
-            return {false, 
-                    0x55, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "D",
-                    "L",
-                   };
-
-        case 0x56:
-            return {false, 
-                    0x56, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "D",
-                    "(HL)",
-                   };
-
-        case 0x57:
-            return {false, 
-                    0x57, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "D",
-                    "A",
-                   };
-
-        case 0x58:
-            return {false, 
-                    0x58, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "E",
-                    "B",
-                   };
-
-        case 0x59:
-            return {false, 
-                    0x59, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "E",
-                    "C",
-                   };
-
-        case 0x5A:
-            return {false, 
-                    0x5A, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "E",
-                    "D",
-                   };
-
-        case 0x5B:
-            return {false, 
-                    0x5B, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "E",
-                    "E",
-                   };
-
-        case 0x5C:
-            return {false, 
-                    0x5C, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "E",
-                    "H",
-                   };
-
-        case 0x5D:
-            return {false, 
-                    0x5D, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "E",
-                    "L",
-                   };
-
-        case 0x5E:
-            return {false, 
-                    0x5E, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "E",
-                    "(HL)",
-                   };
-
-        case 0x5F:
-            return {false, 
-                    0x5F, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "E",
-                    "A",
-                   };
-
-        case 0x60:
-            return {false, 
-                    0x60, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "H",
-                    "B",
-                   };
-
-        case 0x61:
-            return {false, 
-                    0x61, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "H",
-                    "C",
-                   };
-
-        case 0x62:
-            return {false, 
-                    0x62, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "H",
-                    "D",
-                   };
-
-        case 0x63:
-            return {false, 
-                    0x63, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "H",
-                    "E",
-                   };
-
-        case 0x64:
-            return {false, 
-                    0x64, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "H",
-                    "H",
-                   };
-
-        case 0x65:
-            return {false, 
-                    0x65, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "H",
-                    "L",
-                   };
-
-        case 0x66:
-            return {false, 
-                    0x66, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "H",
-                    "(HL)",
-                   };
-
-        case 0x67:
-            return {false, 
-                    0x67, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "H",
-                    "A",
-                   };
-
-        case 0x68:
-            return {false, 
-                    0x68, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "L",
-                    "B",
-                   };
-
-        case 0x69:
-            return {false, 
-                    0x69, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "L",
-                    "C",
-                   };
-
-        case 0x6A:
-            return {false, 
-                    0x6A, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "L",
-                    "D",
-                   };
-
-        case 0x6B:
-            return {false, 
-                    0x6B, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "L",
-                    "E",
-                   };
-
-        case 0x6C:
-            return {false, 
-                    0x6C, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "L",
-                    "H",
-                   };
-
-        case 0x6D:
-            return {false, 
-                    0x6D, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "L",
-                    "L",
-                   };
-
-        case 0x6E:
-            return {false, 
-                    0x6E, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "L",
-                    "(HL)",
-                   };
-
-        case 0x6F:
-            return {false, 
-                    0x6F, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "L",
-                    "A",
-                   };
-
-        case 0x70:
-            return {false, 
-                    0x70, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(HL)",
-                    "B",
-                   };
-
-        case 0x71:
-            return {false, 
-                    0x71, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(HL)",
-                    "C",
-                   };
-
-        case 0x72:
-            return {false, 
-                    0x72, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(HL)",
-                    "D",
-                   };
-
-        case 0x73:
-            return {false, 
-                    0x73, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(HL)",
-                    "E",
-                   };
-
-        case 0x74:
-            return {false, 
-                    0x74, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(HL)",
-                    "H",
-                   };
-
-        case 0x75:
-            return {false, 
-                    0x75, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(HL)",
-                    "L",
-                   };
-
-        case 0x76:
-            return {false, 
-                    0x76, 
-                    "HALT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0x77:
-            return {false, 
-                    0x77, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(HL)",
-                    "A",
-                   };
-
-        case 0x78:
-            return {false, 
-                    0x78, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "B",
-                   };
-
-        case 0x79:
-            return {false, 
-                    0x79, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "C",
-                   };
-
-        case 0x7A:
-            return {false, 
-                    0x7A, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "D",
-                   };
-
-        case 0x7B:
-            return {false, 
-                    0x7B, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "E",
-                   };
-
-        case 0x7C:
-            return {false, 
-                    0x7C, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "H",
-                   };
-
-        case 0x7D:
-            return {false, 
-                    0x7D, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "L",
-                   };
-
-        case 0x7E:
-            return {false, 
-                    0x7E, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "(HL)",
-                   };
-
-        case 0x7F:
-            return {false, 
-                    0x7F, 
-                    "LD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "A",
-                   };
-
-        case 0x80:
-            return {false, 
-                    0x80, 
-                    "ADD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "B",
-                   };
-
-        case 0x81:
-            return {false, 
-                    0x81, 
-                    "ADD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "C",
-                   };
-
-        case 0x82:
-            return {false, 
-                    0x82, 
-                    "ADD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "D",
-                   };
-
-        case 0x83:
-            return {false, 
-                    0x83, 
-                    "ADD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "E",
-                   };
-
-        case 0x84:
-            return {false, 
-                    0x84, 
-                    "ADD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "H",
-                   };
-
-        case 0x85:
-            return {false, 
-                    0x85, 
-                    "ADD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "L",
-                   };
-
-        case 0x86:
-            return {false, 
-                    0x86, 
-                    "ADD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "(HL)",
-                   };
-
-        case 0x87:
-            return {false, 
-                    0x87, 
-                    "ADD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "A",
-                   };
-
-        case 0x88:
-            return {false, 
-                    0x88, 
-                    "ADC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "B",
-                   };
-
-        case 0x89:
-            return {false, 
-                    0x89, 
-                    "ADC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "C",
-                   };
-
-        case 0x8A:
-            return {false, 
-                    0x8A, 
-                    "ADC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "D",
-                   };
-
-        case 0x8B:
-            return {false, 
-                    0x8B, 
-                    "ADC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "E",
-                   };
-
-        case 0x8C:
-            return {false, 
-                    0x8C, 
-                    "ADC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "H",
-                   };
-
-        case 0x8D:
-            return {false, 
-                    0x8D, 
-                    "ADC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "L",
-                   };
-
-        case 0x8E:
-            return {false, 
-                    0x8E, 
-                    "ADC",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "(HL)",
-                   };
-
-        case 0x8F:
-            return {false, 
-                    0x8F, 
-                    "ADC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "A",
-                   };
-
-        case 0x90:
-            return {false, 
-                    0x90, 
-                    "SUB",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "B",
-                   };
-
-        case 0x91:
-            return {false, 
-                    0x91, 
-                    "SUB",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "C",
-                   };
-
-        case 0x92:
-            return {false, 
-                    0x92, 
-                    "SUB",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "D",
-                   };
-
-        case 0x93:
-            return {false, 
-                    0x93, 
-                    "SUB",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "E",
-                   };
-
-        case 0x94:
-            return {false, 
-                    0x94, 
-                    "SUB",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "H",
-                   };
-
-        case 0x95:
-            return {false, 
-                    0x95, 
-                    "SUB",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "L",
-                   };
-
-        case 0x96:
-            return {false, 
-                    0x96, 
-                    "SUB",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "(HL)",
-                   };
-
-        case 0x97:
-            return {false, 
-                    0x97, 
-                    "SUB",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::SET,
-                    FlagEffect::SET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "A",
-                   };
-
-        case 0x98:
-            return {false, 
-                    0x98, 
-                    "SBC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "B",
-                   };
-
-        case 0x99:
-            return {false, 
-                    0x99, 
-                    "SBC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "C",
-                   };
-
-        case 0x9A:
-            return {false, 
-                    0x9A, 
-                    "SBC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "D",
-                   };
-
-        case 0x9B:
-            return {false, 
-                    0x9B, 
-                    "SBC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "E",
-                   };
-
-        case 0x9C:
-            return {false, 
-                    0x9C, 
-                    "SBC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "H",
-                   };
-
-        case 0x9D:
-            return {false, 
-                    0x9D, 
-                    "SBC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "L",
-                   };
-
-        case 0x9E:
-            return {false, 
-                    0x9E, 
-                    "SBC",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "(HL)",
-                   };
-
-        case 0x9F:
-            return {false, 
-                    0x9F, 
-                    "SBC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::NONE,
-                    "A",
-                    "A",
-                   };
-
-        case 0xA0:
-            return {false, 
-                    0xA0, 
-                    "AND",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "B",
-                   };
-
-        case 0xA1:
-            return {false, 
-                    0xA1, 
-                    "AND",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "C",
-                   };
-
-        case 0xA2:
-            return {false, 
-                    0xA2, 
-                    "AND",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "D",
-                   };
-
-        case 0xA3:
-            return {false, 
-                    0xA3, 
-                    "AND",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "E",
-                   };
-
-        case 0xA4:
-            return {false, 
-                    0xA4, 
-                    "AND",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "H",
-                   };
-
-        case 0xA5:
-            return {false, 
-                    0xA5, 
-                    "AND",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "L",
-                   };
-
-        case 0xA6:
-            return {false, 
-                    0xA6, 
-                    "AND",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "(HL)",
-                   };
-
-        case 0xA7:
-            return {false, 
-                    0xA7, 
-                    "AND",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "A",
-                   };
-
-        case 0xA8:
-            return {false, 
-                    0xA8, 
-                    "XOR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "B",
-                   };
-
-        case 0xA9:
-            return {false, 
-                    0xA9, 
-                    "XOR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "C",
-                   };
-
-        case 0xAA:
-            return {false, 
-                    0xAA, 
-                    "XOR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "D",
-                   };
-
-        case 0xAB:
-            return {false, 
-                    0xAB, 
-                    "XOR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "E",
-                   };
-
-        case 0xAC:
-            return {false, 
-                    0xAC, 
-                    "XOR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "H",
-                   };
-
-        case 0xAD:
-            return {false, 
-                    0xAD, 
-                    "XOR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "L",
-                   };
-
-        case 0xAE:
-            return {false, 
-                    0xAE, 
-                    "XOR",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "(HL)",
-                   };
-
-        case 0xAF:
-            return {false, 
-                    0xAF, 
-                    "XOR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::SET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "A",
-                   };
-
-        case 0xB0:
-            return {false, 
-                    0xB0, 
-                    "OR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "B",
-                   };
-
-        case 0xB1:
-            return {false, 
-                    0xB1, 
-                    "OR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "C",
-                   };
-
-        case 0xB2:
-            return {false, 
-                    0xB2, 
-                    "OR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "D",
-                   };
-
-        case 0xB3:
-            return {false, 
-                    0xB3, 
-                    "OR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "E",
-                   };
-
-        case 0xB4:
-            return {false, 
-                    0xB4, 
-                    "OR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "H",
-                   };
-
-        case 0xB5:
-            return {false, 
-                    0xB5, 
-                    "OR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "L",
-                   };
-
-        case 0xB6:
-            return {false, 
-                    0xB6, 
-                    "OR",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "(HL)",
-                   };
-
-        case 0xB7:
-            return {false, 
-                    0xB7, 
-                    "OR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "A",
-                   };
-
-        case 0xB8:
-            return {false, 
-                    0xB8, 
-                    "CP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "B",
-                   };
-
-        case 0xB9:
-            return {false, 
-                    0xB9, 
-                    "CP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "C",
-                   };
-
-        case 0xBA:
-            return {false, 
-                    0xBA, 
-                    "CP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "D",
-                   };
-
-        case 0xBB:
-            return {false, 
-                    0xBB, 
-                    "CP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "E",
-                   };
-
-        case 0xBC:
-            return {false, 
-                    0xBC, 
-                    "CP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "H",
-                   };
-
-        case 0xBD:
-            return {false, 
-                    0xBD, 
-                    "CP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "L",
-                   };
-
-        case 0xBE:
-            return {false, 
-                    0xBE, 
-                    "CP",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "(HL)",
-                   };
-
-        case 0xBF:
-            return {false, 
-                    0xBF, 
-                    "CP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::SET,
-                    FlagEffect::SET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "A",
-                   };
-
-        case 0xC0:
-            return {false, 
-                    0xC0, 
-                    "RET",
-                    1,
-                    20,
-                    8,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "NZ",
-                    "",
-                   };
-
-        case 0xC1:
-            return {false, 
-                    0xC1, 
-                    "POP",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "BC",
-                    "",
-                   };
-
-        case 0xC2:
-            return {false, 
-                    0xC2, 
-                    "JP",
-                    3,
-                    16,
-                    12,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "NZ",
-                    "a16",
-                   };
-
-        case 0xC3:
-            return {false, 
-                    0xC3, 
-                    "JP",
-                    3,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "a16",
-                    "",
-                   };
-
-        case 0xC4:
-            return {false, 
-                    0xC4, 
-                    "CALL",
-                    3,
-                    24,
-                    12,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "NZ",
-                    "a16",
-                   };
-
-        case 0xC5:
-            return {false, 
-                    0xC5, 
-                    "PUSH",
-                    1,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "BC",
-                    "",
-                   };
-
-        case 0xC6:
-            return {false, 
-                    0xC6, 
-                    "ADD",
-                    2,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "u8",
-                   };
-
-        case 0xC7:
-            return {false, 
-                    0xC7, 
-                    "RST",
-                    1,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "00h",
-                    "",
-                   };
-
-        case 0xC8:
-            return {false, 
-                    0xC8, 
-                    "RET",
-                    1,
-                    20,
-                    8,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "Z",
-                    "",
-                   };
-
-        case 0xC9:
-            return {false, 
-                    0xC9, 
-                    "RET",
-                    1,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xCA:
-            return {false, 
-                    0xCA, 
-                    "JP",
-                    3,
-                    16,
-                    12,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "Z",
-                    "a16",
-                   };
-
-        case 0xCB:
-            return {false, 
-                    0xCB, 
-                    "PREFIX",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xCC:
-            return {false, 
-                    0xCC, 
-                    "CALL",
-                    3,
-                    24,
-                    12,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "Z",
-                    "a16",
-                   };
-
-        case 0xCD:
-            return {false, 
-                    0xCD, 
-                    "CALL",
-                    3,
-                    24,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "a16",
-                    "",
-                   };
-
-        case 0xCE:
-            return {false, 
-                    0xCE, 
-                    "ADC",
-                    2,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "u8",
-                   };
-
-        case 0xCF:
-            return {false, 
-                    0xCF, 
-                    "RST",
-                    1,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "08h",
-                    "",
-                   };
-
-        case 0xD0:
-            return {false, 
-                    0xD0, 
-                    "RET",
-                    1,
-                    20,
-                    8,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "NC",
-                    "",
-                   };
-
-        case 0xD1:
-            return {false, 
-                    0xD1, 
-                    "POP",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "DE",
-                    "",
-                   };
-
-        case 0xD2:
-            return {false, 
-                    0xD2, 
-                    "JP",
-                    3,
-                    16,
-                    12,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "NC",
-                    "a16",
-                   };
-
-        case 0xD3:
-            return {false, 
-                    0xD3, 
-                    "ILLEGAL_D3",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xD4:
-            return {false, 
-                    0xD4, 
-                    "CALL",
-                    3,
-                    24,
-                    12,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "NC",
-                    "a16",
-                   };
-
-        case 0xD5:
-            return {false, 
-                    0xD5, 
-                    "PUSH",
-                    1,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "DE",
-                    "",
-                   };
-
-        case 0xD6:
-            return {false, 
-                    0xD6, 
-                    "SUB",
-                    2,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "u8",
-                   };
-
-        case 0xD7:
-            return {false, 
-                    0xD7, 
-                    "RST",
-                    1,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "10h",
-                    "",
-                   };
-
-        case 0xD8:
-            return {false, 
-                    0xD8, 
-                    "RET",
-                    1,
-                    20,
-                    8,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "C",
-                    "",
-                   };
-
-        case 0xD9:
-            return {false, 
-                    0xD9, 
-                    "RETI",
-                    1,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xDA:
-            return {false, 
-                    0xDA, 
-                    "JP",
-                    3,
-                    16,
-                    12,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "C",
-                    "a16",
-                   };
-
-        case 0xDB:
-            return {false, 
-                    0xDB, 
-                    "ILLEGAL_DB",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xDC:
-            return {false, 
-                    0xDC, 
-                    "CALL",
-                    3,
-                    24,
-                    12,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "C",
-                    "a16",
-                   };
-
-        case 0xDD:
-            return {false, 
-                    0xDD, 
-                    "ILLEGAL_DD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xDE:
-            return {false, 
-                    0xDE, 
-                    "SBC",
-                    2,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "u8",
-                   };
-
-        case 0xDF:
-            return {false, 
-                    0xDF, 
-                    "RST",
-                    1,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "18h",
-                    "",
-                   };
-
-        case 0xE0:
-            return {false, 
-                    0xE0, 
-                    "LDH",
-                    2,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(a8)",
-                    "A",
-                   };
-
-        case 0xE1:
-            return {false, 
-                    0xE1, 
-                    "POP",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "HL",
-                    "",
-                   };
-
-        case 0xE2:
-            return {false, 
-                    0xE2, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(C)",
-                    "A",
-                   };
-
-        case 0xE3:
-            return {false, 
-                    0xE3, 
-                    "ILLEGAL_E3",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xE4:
-            return {false, 
-                    0xE4, 
-                    "ILLEGAL_E4",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xE5:
-            return {false, 
-                    0xE5, 
-                    "PUSH",
-                    1,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "HL",
-                    "",
-                   };
-
-        case 0xE6:
-            return {false, 
-                    0xE6, 
-                    "AND",
-                    2,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "u8",
-                   };
-
-        case 0xE7:
-            return {false, 
-                    0xE7, 
-                    "RST",
-                    1,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "20h",
-                    "",
-                   };
-
-        case 0xE8:
-            return {false, 
-                    0xE8, 
-                    "ADD",
-                    2,
-                    16,
-                    {},
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "SP",
-                    "i8",
-                   };
-
-        case 0xE9:
-            return {false, 
-                    0xE9, 
-                    "JP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "HL",
-                    "",
-                   };
-
-        case 0xEA:
-            return {false, 
-                    0xEA, 
-                    "LD",
-                    3,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "(a16)",
-                    "A",
-                   };
-
-        case 0xEB:
-            return {false, 
-                    0xEB, 
-                    "ILLEGAL_EB",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xEC:
-            return {false, 
-                    0xEC, 
-                    "ILLEGAL_EC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xED:
-            return {false, 
-                    0xED, 
-                    "ILLEGAL_ED",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xEE:
-            return {false, 
-                    0xEE, 
-                    "XOR",
-                    2,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "u8",
-                   };
-
-        case 0xEF:
-            return {false, 
-                    0xEF, 
-                    "RST",
-                    1,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "28h",
-                    "",
-                   };
-
-        case 0xF0:
-            return {false, 
-                    0xF0, 
-                    "LDH",
-                    2,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "(a8)",
-                   };
-
-        case 0xF1:
-            return {false, 
-                    0xF1, 
-                    "POP",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SUBTRACTION,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "AF",
-                    "",
-                   };
+    inline constexpr std::array<OpCodeTiming, 256> OPCODE_TIMINGS = {{
+        {1, 4, 0}, // 0x00 NOP
+        {3, 12, 0}, // 0x01 LD BC u16
+        {1, 8, 0}, // 0x02 LD (BC) A
+        {1, 8, 0}, // 0x03 INC BC
+        {1, 4, 0}, // 0x04 INC B
+        {1, 4, 0}, // 0x05 DEC B
+        {2, 8, 0}, // 0x06 LD B u8
+        {1, 4, 0}, // 0x07 RLCA
+        {3, 20, 0}, // 0x08 LD (a16) SP
+        {1, 8, 0}, // 0x09 ADD HL BC
+        {1, 8, 0}, // 0x0A LD A (BC)
+        {1, 8, 0}, // 0x0B DEC BC
+        {1, 4, 0}, // 0x0C INC C
+        {1, 4, 0}, // 0x0D DEC C
+        {2, 8, 0}, // 0x0E LD C u8
+        {1, 4, 0}, // 0x0F RRCA
+        {2, 4, 0}, // 0x10 STOP u8
+        {3, 12, 0}, // 0x11 LD DE u16
+        {1, 8, 0}, // 0x12 LD (DE) A
+        {1, 8, 0}, // 0x13 INC DE
+        {1, 4, 0}, // 0x14 INC D
+        {1, 4, 0}, // 0x15 DEC D
+        {2, 8, 0}, // 0x16 LD D u8
+        {1, 4, 0}, // 0x17 RLA
+        {2, 12, 0}, // 0x18 JR i8
+        {1, 8, 0}, // 0x19 ADD HL DE
+        {1, 8, 0}, // 0x1A LD A (DE)
+        {1, 8, 0}, // 0x1B DEC DE
+        {1, 4, 0}, // 0x1C INC E
+        {1, 4, 0}, // 0x1D DEC E
+        {2, 8, 0}, // 0x1E LD E u8
+        {1, 4, 0}, // 0x1F RRA
+        {2, 8, 12}, // 0x20 JR NZ i8
+        {3, 12, 0}, // 0x21 LD HL u16
+        {1, 8, 0}, // 0x22 LD (HL+) A
+        {1, 8, 0}, // 0x23 INC HL
+        {1, 4, 0}, // 0x24 INC H
+        {1, 4, 0}, // 0x25 DEC H
+        {2, 8, 0}, // 0x26 LD H u8
+        {1, 4, 0}, // 0x27 DAA
+        {2, 8, 12}, // 0x28 JR Z i8
+        {1, 8, 0}, // 0x29 ADD HL HL
+        {1, 8, 0}, // 0x2A LD A (HL+)
+        {1, 8, 0}, // 0x2B DEC HL
+        {1, 4, 0}, // 0x2C INC L
+        {1, 4, 0}, // 0x2D DEC L
+        {2, 8, 0}, // 0x2E LD L u8
+        {1, 4, 0}, // 0x2F CPL
+        {2, 8, 12}, // 0x30 JR NC i8
+        {3, 12, 0}, // 0x31 LD SP u16
+        {1, 8, 0}, // 0x32 LD (HL-) A
+        {1, 8, 0}, // 0x33 INC SP
+        {1, 12, 0}, // 0x34 INC (HL)
+        {1, 12, 0}, // 0x35 DEC (HL)
+        {2, 12, 0}, // 0x36 LD (HL) u8
+        {1, 4, 0}, // 0x37 SCF
+        {2, 8, 12}, // 0x38 JR C i8
+        {1, 8, 0}, // 0x39 ADD HL SP
+        {1, 8, 0}, // 0x3A LD A (HL-)
+        {1, 8, 0}, // 0x3B DEC SP
+        {1, 4, 0}, // 0x3C INC A
+        {1, 4, 0}, // 0x3D DEC A
+        {2, 8, 0}, // 0x3E LD A u8
+        {1, 4, 0}, // 0x3F CCF
+        {1, 4, 0}, // 0x40 LD B B
+        {1, 4, 0}, // 0x41 LD B C
+        {1, 4, 0}, // 0x42 LD B D
+        {1, 4, 0}, // 0x43 LD B E
+        {1, 4, 0}, // 0x44 LD B H
+        {1, 4, 0}, // 0x45 LD B L
+        {1, 8, 0}, // 0x46 LD B (HL)
+        {1, 4, 0}, // 0x47 LD B A
+        {1, 4, 0}, // 0x48 LD C B
+        {1, 4, 0}, // 0x49 LD C C
+        {1, 4, 0}, // 0x4A LD C D
+        {1, 4, 0}, // 0x4B LD C E
+        {1, 4, 0}, // 0x4C LD C H
+        {1, 4, 0}, // 0x4D LD C L
+        {1, 8, 0}, // 0x4E LD C (HL)
+        {1, 4, 0}, // 0x4F LD C A
+        {1, 4, 0}, // 0x50 LD D B
+        {1, 4, 0}, // 0x51 LD D C
+        {1, 4, 0}, // 0x52 LD D D
+        {1, 4, 0}, // 0x53 LD D E
+        {1, 4, 0}, // 0x54 LD D H
+        {1, 4, 0}, // 0x55 LD D L
+        {1, 8, 0}, // 0x56 LD D (HL)
+        {1, 4, 0}, // 0x57 LD D A
+        {1, 4, 0}, // 0x58 LD E B
+        {1, 4, 0}, // 0x59 LD E C
+        {1, 4, 0}, // 0x5A LD E D
+        {1, 4, 0}, // 0x5B LD E E
+        {1, 4, 0}, // 0x5C LD E H
+        {1, 4, 0}, // 0x5D LD E L
+        {1, 8, 0}, // 0x5E LD E (HL)
+        {1, 4, 0}, // 0x5F LD E A
+        {1, 4, 0}, // 0x60 LD H B
+        {1, 4, 0}, // 0x61 LD H C
+        {1, 4, 0}, // 0x62 LD H D
+        {1, 4, 0}, // 0x63 LD H E
+        {1, 4, 0}, // 0x64 LD H H
+        {1, 4, 0}, // 0x65 LD H L
+        {1, 8, 0}, // 0x66 LD H (HL)
+        {1, 4, 0}, // 0x67 LD H A
+        {1, 4, 0}, // 0x68 LD L B
+        {1, 4, 0}, // 0x69 LD L C
+        {1, 4, 0}, // 0x6A LD L D
+        {1, 4, 0}, // 0x6B LD L E
+        {1, 4, 0}, // 0x6C LD L H
+        {1, 4, 0}, // 0x6D LD L L
+        {1, 8, 0}, // 0x6E LD L (HL)
+        {1, 4, 0}, // 0x6F LD L A
+        {1, 8, 0}, // 0x70 LD (HL) B
+        {1, 8, 0}, // 0x71 LD (HL) C
+        {1, 8, 0}, // 0x72 LD (HL) D
+        {1, 8, 0}, // 0x73 LD (HL) E
+        {1, 8, 0}, // 0x74 LD (HL) H
+        {1, 8, 0}, // 0x75 LD (HL) L
+        {1, 4, 0}, // 0x76 HALT
+        {1, 8, 0}, // 0x77 LD (HL) A
+        {1, 4, 0}, // 0x78 LD A B
+        {1, 4, 0}, // 0x79 LD A C
+        {1, 4, 0}, // 0x7A LD A D
+        {1, 4, 0}, // 0x7B LD A E
+        {1, 4, 0}, // 0x7C LD A H
+        {1, 4, 0}, // 0x7D LD A L
+        {1, 8, 0}, // 0x7E LD A (HL)
+        {1, 4, 0}, // 0x7F LD A A
+        {1, 4, 0}, // 0x80 ADD A B
+        {1, 4, 0}, // 0x81 ADD A C
+        {1, 4, 0}, // 0x82 ADD A D
+        {1, 4, 0}, // 0x83 ADD A E
+        {1, 4, 0}, // 0x84 ADD A H
+        {1, 4, 0}, // 0x85 ADD A L
+        {1, 8, 0}, // 0x86 ADD A (HL)
+        {1, 4, 0}, // 0x87 ADD A A
+        {1, 4, 0}, // 0x88 ADC A B
+        {1, 4, 0}, // 0x89 ADC A C
+        {1, 4, 0}, // 0x8A ADC A D
+        {1, 4, 0}, // 0x8B ADC A E
+        {1, 4, 0}, // 0x8C ADC A H
+        {1, 4, 0}, // 0x8D ADC A L
+        {1, 8, 0}, // 0x8E ADC A (HL)
+        {1, 4, 0}, // 0x8F ADC A A
+        {1, 4, 0}, // 0x90 SUB A B
+        {1, 4, 0}, // 0x91 SUB A C
+        {1, 4, 0}, // 0x92 SUB A D
+        {1, 4, 0}, // 0x93 SUB A E
+        {1, 4, 0}, // 0x94 SUB A H
+        {1, 4, 0}, // 0x95 SUB A L
+        {1, 8, 0}, // 0x96 SUB A (HL)
+        {1, 4, 0}, // 0x97 SUB A A
+        {1, 4, 0}, // 0x98 SBC A B
+        {1, 4, 0}, // 0x99 SBC A C
+        {1, 4, 0}, // 0x9A SBC A D
+        {1, 4, 0}, // 0x9B SBC A E
+        {1, 4, 0}, // 0x9C SBC A H
+        {1, 4, 0}, // 0x9D SBC A L
+        {1, 8, 0}, // 0x9E SBC A (HL)
+        {1, 4, 0}, // 0x9F SBC A A
+        {1, 4, 0}, // 0xA0 AND A B
+        {1, 4, 0}, // 0xA1 AND A C
+        {1, 4, 0}, // 0xA2 AND A D
+        {1, 4, 0}, // 0xA3 AND A E
+        {1, 4, 0}, // 0xA4 AND A H
+        {1, 4, 0}, // 0xA5 AND A L
+        {1, 8, 0}, // 0xA6 AND A (HL)
+        {1, 4, 0}, // 0xA7 AND A A
+        {1, 4, 0}, // 0xA8 XOR A B
+        {1, 4, 0}, // 0xA9 XOR A C
+        {1, 4, 0}, // 0xAA XOR A D
+        {1, 4, 0}, // 0xAB XOR A E
+        {1, 4, 0}, // 0xAC XOR A H
+        {1, 4, 0}, // 0xAD XOR A L
+        {1, 8, 0}, // 0xAE XOR A (HL)
+        {1, 4, 0}, // 0xAF XOR A A
+        {1, 4, 0}, // 0xB0 OR A B
+        {1, 4, 0}, // 0xB1 OR A C
+        {1, 4, 0}, // 0xB2 OR A D
+        {1, 4, 0}, // 0xB3 OR A E
+        {1, 4, 0}, // 0xB4 OR A H
+        {1, 4, 0}, // 0xB5 OR A L
+        {1, 8, 0}, // 0xB6 OR A (HL)
+        {1, 4, 0}, // 0xB7 OR A A
+        {1, 4, 0}, // 0xB8 CP A B
+        {1, 4, 0}, // 0xB9 CP A C
+        {1, 4, 0}, // 0xBA CP A D
+        {1, 4, 0}, // 0xBB CP A E
+        {1, 4, 0}, // 0xBC CP A H
+        {1, 4, 0}, // 0xBD CP A L
+        {1, 8, 0}, // 0xBE CP A (HL)
+        {1, 4, 0}, // 0xBF CP A A
+        {1, 8, 20}, // 0xC0 RET NZ
+        {1, 12, 0}, // 0xC1 POP BC
+        {3, 12, 16}, // 0xC2 JP NZ a16
+        {3, 16, 0}, // 0xC3 JP a16
+        {3, 12, 24}, // 0xC4 CALL NZ a16
+        {1, 16, 0}, // 0xC5 PUSH BC
+        {2, 8, 0}, // 0xC6 ADD A u8
+        {1, 16, 0}, // 0xC7 RST 00h
+        {1, 8, 20}, // 0xC8 RET Z
+        {1, 16, 0}, // 0xC9 RET
+        {3, 12, 16}, // 0xCA JP Z a16
+        {1, 4, 0}, // 0xCB PREFIX
+        {3, 12, 24}, // 0xCC CALL Z a16
+        {3, 24, 0}, // 0xCD CALL a16
+        {2, 8, 0}, // 0xCE ADC A u8
+        {1, 16, 0}, // 0xCF RST 08h
+        {1, 8, 20}, // 0xD0 RET NC
+        {1, 12, 0}, // 0xD1 POP DE
+        {3, 12, 16}, // 0xD2 JP NC a16
+        {1, 4, 0}, // 0xD3 ILLEGAL_D3
+        {3, 12, 24}, // 0xD4 CALL NC a16
+        {1, 16, 0}, // 0xD5 PUSH DE
+        {2, 8, 0}, // 0xD6 SUB A u8
+        {1, 16, 0}, // 0xD7 RST 10h
+        {1, 8, 20}, // 0xD8 RET C
+        {1, 16, 0}, // 0xD9 RETI
+        {3, 12, 16}, // 0xDA JP C a16
+        {1, 4, 0}, // 0xDB ILLEGAL_DB
+        {3, 12, 24}, // 0xDC CALL C a16
+        {1, 4, 0}, // 0xDD ILLEGAL_DD
+        {2, 8, 0}, // 0xDE SBC A u8
+        {1, 16, 0}, // 0xDF RST 18h
+        {2, 12, 0}, // 0xE0 LDH (a8) A
+        {1, 12, 0}, // 0xE1 POP HL
+        {1, 8, 0}, // 0xE2 LD (C) A
+        {1, 4, 0}, // 0xE3 ILLEGAL_E3
+        {1, 4, 0}, // 0xE4 ILLEGAL_E4
+        {1, 16, 0}, // 0xE5 PUSH HL
+        {2, 8, 0}, // 0xE6 AND A u8
+        {1, 16, 0}, // 0xE7 RST 20h
+        {2, 16, 0}, // 0xE8 ADD SP i8
+        {1, 4, 0}, // 0xE9 JP HL
+        {3, 16, 0}, // 0xEA LD (a16) A
+        {1, 4, 0}, // 0xEB ILLEGAL_EB
+        {1, 4, 0}, // 0xEC ILLEGAL_EC
+        {1, 4, 0}, // 0xED ILLEGAL_ED
+        {2, 8, 0}, // 0xEE XOR A u8
+        {1, 16, 0}, // 0xEF RST 28h
+        {2, 12, 0}, // 0xF0 LDH A (a8)
+        {1, 12, 0}, // 0xF1 POP AF
+        {1, 8, 0}, // 0xF2 LD A (C)
+        {1, 4, 0}, // 0xF3 DI
+        {1, 4, 0}, // 0xF4 ILLEGAL_F4
+        {1, 16, 0}, // 0xF5 PUSH AF
+        {2, 8, 0}, // 0xF6 OR A u8
+        {1, 16, 0}, // 0xF7 RST 30h
+        {2, 12, 0}, // 0xF8 LD HL SP+
+        {1, 8, 0}, // 0xF9 LD SP HL
+        {3, 16, 0}, // 0xFA LD A (a16)
+        {1, 4, 0}, // 0xFB EI
+        {1, 4, 0}, // 0xFC ILLEGAL_FC
+        {1, 4, 0}, // 0xFD ILLEGAL_FD
+        {2, 8, 0}, // 0xFE CP A u8
+        {1, 16, 0}, // 0xFF RST 38h
+    }};
+
+    inline constexpr std::array<OpCodeDetails, 256> OPCODE_DETAILS = {{
+        {"NOP", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "BC", "u16", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "(BC)", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"INC", "BC", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"INC", "B", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"DEC", "B", "", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"LD", "B", "u8", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RLCA", "", "", FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"LD", "(a16)", "SP", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ADD", "HL", "BC", FlagEffect::NONE, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"LD", "A", "(BC)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"DEC", "BC", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"INC", "C", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"DEC", "C", "", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"LD", "C", "u8", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RRCA", "", "", FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"STOP", "u8", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "DE", "u16", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "(DE)", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"INC", "DE", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"INC", "D", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"DEC", "D", "", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"LD", "D", "u8", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RLA", "", "", FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"JR", "i8", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ADD", "HL", "DE", FlagEffect::NONE, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"LD", "A", "(DE)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"DEC", "DE", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"INC", "E", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"DEC", "E", "", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"LD", "E", "u8", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RRA", "", "", FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"JR", "NZ", "i8", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "HL", "u16", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "(HL+)", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"INC", "HL", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"INC", "H", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"DEC", "H", "", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"LD", "H", "u8", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"DAA", "", "", FlagEffect::ZERO, FlagEffect::NONE, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"JR", "Z", "i8", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ADD", "HL", "HL", FlagEffect::NONE, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"LD", "A", "(HL+)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"DEC", "HL", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"INC", "L", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"DEC", "L", "", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"LD", "L", "u8", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"CPL", "", "", FlagEffect::NONE, FlagEffect::SET, FlagEffect::SET, FlagEffect::NONE},
+        {"JR", "NC", "i8", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "SP", "u16", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "(HL-)", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"INC", "SP", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"INC", "(HL)", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"DEC", "(HL)", "", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"LD", "(HL)", "u8", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SCF", "", "", FlagEffect::NONE, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::SET},
+        {"JR", "C", "i8", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ADD", "HL", "SP", FlagEffect::NONE, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"LD", "A", "(HL-)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"DEC", "SP", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"INC", "A", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"DEC", "A", "", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"LD", "A", "u8", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"CCF", "", "", FlagEffect::NONE, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"LD", "B", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "B", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "B", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "B", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "B", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "B", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "B", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "B", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "C", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "C", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "C", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "C", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "C", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "C", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "C", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "C", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "D", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "D", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "D", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "D", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "D", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "D", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "D", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "D", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "E", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "E", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "E", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "E", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "E", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "E", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "E", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "E", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "H", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "H", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "H", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "H", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "H", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "H", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "H", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "H", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "L", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "L", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "L", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "L", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "L", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "L", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "L", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "L", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "(HL)", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "(HL)", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "(HL)", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "(HL)", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "(HL)", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "(HL)", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"HALT", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "(HL)", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "A", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "A", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "A", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "A", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "A", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "A", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "A", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "A", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ADD", "A", "B", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"ADD", "A", "C", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"ADD", "A", "D", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"ADD", "A", "E", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"ADD", "A", "H", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"ADD", "A", "L", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"ADD", "A", "(HL)", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"ADD", "A", "A", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"ADC", "A", "B", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"ADC", "A", "C", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"ADC", "A", "D", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"ADC", "A", "E", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"ADC", "A", "H", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"ADC", "A", "L", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"ADC", "A", "(HL)", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"ADC", "A", "A", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"SUB", "A", "B", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"SUB", "A", "C", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"SUB", "A", "D", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"SUB", "A", "E", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"SUB", "A", "H", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"SUB", "A", "L", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"SUB", "A", "(HL)", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"SUB", "A", "A", FlagEffect::SET, FlagEffect::SET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"SBC", "A", "B", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"SBC", "A", "C", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"SBC", "A", "D", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"SBC", "A", "E", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"SBC", "A", "H", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"SBC", "A", "L", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"SBC", "A", "(HL)", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"SBC", "A", "A", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::NONE},
+        {"AND", "A", "B", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::UNSET},
+        {"AND", "A", "C", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::UNSET},
+        {"AND", "A", "D", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::UNSET},
+        {"AND", "A", "E", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::UNSET},
+        {"AND", "A", "H", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::UNSET},
+        {"AND", "A", "L", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::UNSET},
+        {"AND", "A", "(HL)", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::UNSET},
+        {"AND", "A", "A", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::UNSET},
+        {"XOR", "A", "B", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"XOR", "A", "C", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"XOR", "A", "D", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"XOR", "A", "E", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"XOR", "A", "H", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"XOR", "A", "L", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"XOR", "A", "(HL)", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"XOR", "A", "A", FlagEffect::SET, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"OR", "A", "B", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"OR", "A", "C", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"OR", "A", "D", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"OR", "A", "E", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"OR", "A", "H", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"OR", "A", "L", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"OR", "A", "(HL)", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"OR", "A", "A", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"CP", "A", "B", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"CP", "A", "C", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"CP", "A", "D", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"CP", "A", "E", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"CP", "A", "H", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"CP", "A", "L", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"CP", "A", "(HL)", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"CP", "A", "A", FlagEffect::SET, FlagEffect::SET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"RET", "NZ", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"POP", "BC", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"JP", "NZ", "a16", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"JP", "a16", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"CALL", "NZ", "a16", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"PUSH", "BC", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ADD", "A", "u8", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"RST", "00h", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RET", "Z", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RET", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"JP", "Z", "a16", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"PREFIX", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"CALL", "Z", "a16", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"CALL", "a16", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ADC", "A", "u8", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"RST", "08h", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RET", "NC", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"POP", "DE", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"JP", "NC", "a16", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ILLEGAL_D3", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"CALL", "NC", "a16", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"PUSH", "DE", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SUB", "A", "u8", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"RST", "10h", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RET", "C", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RETI", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"JP", "C", "a16", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ILLEGAL_DB", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"CALL", "C", "a16", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ILLEGAL_DD", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SBC", "A", "u8", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"RST", "18h", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LDH", "(a8)", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"POP", "HL", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "(C)", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ILLEGAL_E3", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ILLEGAL_E4", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"PUSH", "HL", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"AND", "A", "u8", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::UNSET},
+        {"RST", "20h", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ADD", "SP", "i8", FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"JP", "HL", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "(a16)", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ILLEGAL_EB", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ILLEGAL_EC", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ILLEGAL_ED", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"XOR", "A", "u8", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"RST", "28h", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LDH", "A", "(a8)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"POP", "AF", "", FlagEffect::ZERO, FlagEffect::SUBTRACTION, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"LD", "A", "(C)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"DI", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ILLEGAL_F4", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"PUSH", "AF", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"OR", "A", "u8", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"RST", "30h", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "HL", "SP+", FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"LD", "SP", "HL", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"LD", "A", "(a16)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"EI", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ILLEGAL_FC", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"ILLEGAL_FD", "", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"CP", "A", "u8", FlagEffect::ZERO, FlagEffect::SET, FlagEffect::HALF_CARRY, FlagEffect::CARRY},
+        {"RST", "38h", "", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+    }};
+
+    inline constexpr std::array<OpCodeTiming, 256> OPCODE_TIMINGS_PREFIXED = {{
+        {1, 4, 0}, // 0x00 RLC B
+        {1, 4, 0}, // 0x01 RLC C
+        {1, 4, 0}, // 0x02 RLC D
+        {1, 4, 0}, // 0x03 RLC E
+        {1, 4, 0}, // 0x04 RLC H
+        {1, 4, 0}, // 0x05 RLC L
+        {1, 12, 0}, // 0x06 RLC (HL)
+        {1, 4, 0}, // 0x07 RLC A
+        {1, 4, 0}, // 0x08 RRC B
+        {1, 4, 0}, // 0x09 RRC C
+        {1, 4, 0}, // 0x0A RRC D
+        {1, 4, 0}, // 0x0B RRC E
+        {1, 4, 0}, // 0x0C RRC H
+        {1, 4, 0}, // 0x0D RRC L
+        {1, 12, 0}, // 0x0E RRC (HL)
+        {1, 4, 0}, // 0x0F RRC A
+        {1, 4, 0}, // 0x10 RL B
+        {1, 4, 0}, // 0x11 RL C
+        {1, 4, 0}, // 0x12 RL D
+        {1, 4, 0}, // 0x13 RL E
+        {1, 4, 0}, // 0x14 RL H
+        {1, 4, 0}, // 0x15 RL L
+        {1, 12, 0}, // 0x16 RL (HL)
+        {1, 4, 0}, // 0x17 RL A
+        {1, 4, 0}, // 0x18 RR B
+        {1, 4, 0}, // 0x19 RR C
+        {1, 4, 0}, // 0x1A RR D
+        {1, 4, 0}, // 0x1B RR E
+        {1, 4, 0}, // 0x1C RR H
+        {1, 4, 0}, // 0x1D RR L
+        {1, 12, 0}, // 0x1E RR (HL)
+        {1, 4, 0}, // 0x1F RR A
+        {1, 4, 0}, // 0x20 SLA B
+        {1, 4, 0}, // 0x21 SLA C
+        {1, 4, 0}, // 0x22 SLA D
+        {1, 4, 0}, // 0x23 SLA E
+        {1, 4, 0}, // 0x24 SLA H
+        {1, 4, 0}, // 0x25 SLA L
+        {1, 12, 0}, // 0x26 SLA (HL)
+        {1, 4, 0}, // 0x27 SLA A
+        {1, 4, 0}, // 0x28 SRA B
+        {1, 4, 0}, // 0x29 SRA C
+        {1, 4, 0}, // 0x2A SRA D
+        {1, 4, 0}, // 0x2B SRA E
+        {1, 4, 0}, // 0x2C SRA H
+        {1, 4, 0}, // 0x2D SRA L
+        {1, 12, 0}, // 0x2E SRA (HL)
+        {1, 4, 0}, // 0x2F SRA A
+        {1, 4, 0}, // 0x30 SWAP B
+        {1, 4, 0}, // 0x31 SWAP C
+        {1, 4, 0}, // 0x32 SWAP D
+        {1, 4, 0}, // 0x33 SWAP E
+        {1, 4, 0}, // 0x34 SWAP H
+        {1, 4, 0}, // 0x35 SWAP L
+        {1, 12, 0}, // 0x36 SWAP (HL)
+        {1, 4, 0}, // 0x37 SWAP A
+        {1, 4, 0}, // 0x38 SRL B
+        {1, 4, 0}, // 0x39 SRL C
+        {1, 4, 0}, // 0x3A SRL D
+        {1, 4, 0}, // 0x3B SRL E
+        {1, 4, 0}, // 0x3C SRL H
+        {1, 4, 0}, // 0x3D SRL L
+        {1, 12, 0}, // 0x3E SRL (HL)
+        {1, 4, 0}, // 0x3F SRL A
+        {1, 4, 0}, // 0x40 BIT 0 B
+        {1, 4, 0}, // 0x41 BIT 0 C
+        {1, 4, 0}, // 0x42 BIT 0 D
+        {1, 4, 0}, // 0x43 BIT 0 E
+        {1, 4, 0}, // 0x44 BIT 0 H
+        {1, 4, 0}, // 0x45 BIT 0 L
+        {1, 8, 0}, // 0x46 BIT 0 (HL)
+        {1, 4, 0}, // 0x47 BIT 0 A
+        {1, 4, 0}, // 0x48 BIT 1 B
+        {1, 4, 0}, // 0x49 BIT 1 C
+        {1, 4, 0}, // 0x4A BIT 1 D
+        {1, 4, 0}, // 0x4B BIT 1 E
+        {1, 4, 0}, // 0x4C BIT 1 H
+        {1, 4, 0}, // 0x4D BIT 1 L
+        {1, 8, 0}, // 0x4E BIT 1 (HL)
+        {1, 4, 0}, // 0x4F BIT 1 A
+        {1, 4, 0}, // 0x50 BIT 2 B
+        {1, 4, 0}, // 0x51 BIT 2 C
+        {1, 4, 0}, // 0x52 BIT 2 D
+        {1, 4, 0}, // 0x53 BIT 2 E
+        {1, 4, 0}, // 0x54 BIT 2 H
+        {1, 4, 0}, // 0x55 BIT 2 L
+        {1, 8, 0}, // 0x56 BIT 2 (HL)
+        {1, 4, 0}, // 0x57 BIT 2 A
+        {1, 4, 0}, // 0x58 BIT 3 B
+        {1, 4, 0}, // 0x59 BIT 3 C
+        {1, 4, 0}, // 0x5A BIT 3 D
+        {1, 4, 0}, // 0x5B BIT 3 E
+        {1, 4, 0}, // 0x5C BIT 3 H
+        {1, 4, 0}, // 0x5D BIT 3 L
+        {1, 8, 0}, // 0x5E BIT 3 (HL)
+        {1, 4, 0}, // 0x5F BIT 3 A
+        {1, 4, 0}, // 0x60 BIT 4 B
+        {1, 4, 0}, // 0x61 BIT 4 C
+        {1, 4, 0}, // 0x62 BIT 4 D
+        {1, 4, 0}, // 0x63 BIT 4 E
+        {1, 4, 0}, // 0x64 BIT 4 H
+        {1, 4, 0}, // 0x65 BIT 4 L
+        {1, 8, 0}, // 0x66 BIT 4 (HL)
+        {1, 4, 0}, // 0x67 BIT 4 A
+        {1, 4, 0}, // 0x68 BIT 5 B
+        {1, 4, 0}, // 0x69 BIT 5 C
+        {1, 4, 0}, // 0x6A BIT 5 D
+        {1, 4, 0}, // 0x6B BIT 5 E
+        {1, 4, 0}, // 0x6C BIT 5 H
+        {1, 4, 0}, // 0x6D BIT 5 L
+        {1, 8, 0}, // 0x6E BIT 5 (HL)
+        {1, 4, 0}, // 0x6F BIT 5 A
+        {1, 4, 0}, // 0x70 BIT 6 B
+        {1, 4, 0}, // 0x71 BIT 6 C
+        {1, 4, 0}, // 0x72 BIT 6 D
+        {1, 4, 0}, // 0x73 BIT 6 E
+        {1, 4, 0}, // 0x74 BIT 6 H
+        {1, 4, 0}, // 0x75 BIT 6 L
+        {1, 8, 0}, // 0x76 BIT 6 (HL)
+        {1, 4, 0}, // 0x77 BIT 6 A
+        {1, 4, 0}, // 0x78 BIT 7 B
+        {1, 4, 0}, // 0x79 BIT 7 C
+        {1, 4, 0}, // 0x7A BIT 7 D
+        {1, 4, 0}, // 0x7B BIT 7 E
+        {1, 4, 0}, // 0x7C BIT 7 H
+        {1, 4, 0}, // 0x7D BIT 7 L
+        {1, 8, 0}, // 0x7E BIT 7 (HL)
+        {1, 4, 0}, // 0x7F BIT 7 A
+        {1, 4, 0}, // 0x80 RES 0 B
+        {1, 4, 0}, // 0x81 RES 0 C
+        {1, 4, 0}, // 0x82 RES 0 D
+        {1, 4, 0}, // 0x83 RES 0 E
+        {1, 4, 0}, // 0x84 RES 0 H
+        {1, 4, 0}, // 0x85 RES 0 L
+        {1, 12, 0}, // 0x86 RES 0 (HL)
+        {1, 4, 0}, // 0x87 RES 0 A
+        {1, 4, 0}, // 0x88 RES 1 B
+        {1, 4, 0}, // 0x89 RES 1 C
+        {1, 4, 0}, // 0x8A RES 1 D
+        {1, 4, 0}, // 0x8B RES 1 E
+        {1, 4, 0}, // 0x8C RES 1 H
+        {1, 4, 0}, // 0x8D RES 1 L
+        {1, 12, 0}, // 0x8E RES 1 (HL)
+        {1, 4, 0}, // 0x8F RES 1 A
+        {1, 4, 0}, // 0x90 RES 2 B
+        {1, 4, 0}, // 0x91 RES 2 C
+        {1, 4, 0}, // 0x92 RES 2 D
+        {1, 4, 0}, // 0x93 RES 2 E
+        {1, 4, 0}, // 0x94 RES 2 H
+        {1, 4, 0}, // 0x95 RES 2 L
+        {1, 12, 0}, // 0x96 RES 2 (HL)
+        {1, 4, 0}, // 0x97 RES 2 A
+        {1, 4, 0}, // 0x98 RES 3 B
+        {1, 4, 0}, // 0x99 RES 3 C
+        {1, 4, 0}, // 0x9A RES 3 D
+        {1, 4, 0}, // 0x9B RES 3 E
+        {1, 4, 0}, // 0x9C RES 3 H
+        {1, 4, 0}, // 0x9D RES 3 L
+        {1, 12, 0}, // 0x9E RES 3 (HL)
+        {1, 4, 0}, // 0x9F RES 3 A
+        {1, 4, 0}, // 0xA0 RES 4 B
+        {1, 4, 0}, // 0xA1 RES 4 C
+        {1, 4, 0}, // 0xA2 RES 4 D
+        {1, 4, 0}, // 0xA3 RES 4 E
+        {1, 4, 0}, // 0xA4 RES 4 H
+        {1, 4, 0}, // 0xA5 RES 4 L
+        {1, 12, 0}, // 0xA6 RES 4 (HL)
+        {1, 4, 0}, // 0xA7 RES 4 A
+        {1, 4, 0}, // 0xA8 RES 5 B
+        {1, 4, 0}, // 0xA9 RES 5 C
+        {1, 4, 0}, // 0xAA RES 5 D
+        {1, 4, 0}, // 0xAB RES 5 E
+        {1, 4, 0}, // 0xAC RES 5 H
+        {1, 4, 0}, // 0xAD RES 5 L
+        {1, 12, 0}, // 0xAE RES 5 (HL)
+        {1, 4, 0}, // 0xAF RES 5 A
+        {1, 4, 0}, // 0xB0 RES 6 B
+        {1, 4, 0}, // 0xB1 RES 6 C
+        {1, 4, 0}, // 0xB2 RES 6 D
+        {1, 4, 0}, // 0xB3 RES 6 E
+        {1, 4, 0}, // 0xB4 RES 6 H
+        {1, 4, 0}, // 0xB5 RES 6 L
+        {1, 12, 0}, // 0xB6 RES 6 (HL)
+        {1, 4, 0}, // 0xB7 RES 6 A
+        {1, 4, 0}, // 0xB8 RES 7 B
+        {1, 4, 0}, // 0xB9 RES 7 C
+        {1, 4, 0}, // 0xBA RES 7 D
+        {1, 4, 0}, // 0xBB RES 7 E
+        {1, 4, 0}, // 0xBC RES 7 H
+        {1, 4, 0}, // 0xBD RES 7 L
+        {1, 12, 0}, // 0xBE RES 7 (HL)
+        {1, 4, 0}, // 0xBF RES 7 A
+        {1, 4, 0}, // 0xC0 SET 0 B
+        {1, 4, 0}, // 0xC1 SET 0 C
+        {1, 4, 0}, // 0xC2 SET 0 D
+        {1, 4, 0}, // 0xC3 SET 0 E
+        {1, 4, 0}, // 0xC4 SET 0 H
+        {1, 4, 0}, // 0xC5 SET 0 L
+        {1, 12, 0}, // 0xC6 SET 0 (HL)
+        {1, 4, 0}, // 0xC7 SET 0 A
+        {1, 4, 0}, // 0xC8 SET 1 B
+        {1, 4, 0}, // 0xC9 SET 1 C
+        {1, 4, 0}, // 0xCA SET 1 D
+        {1, 4, 0}, // 0xCB SET 1 E
+        {1, 4, 0}, // 0xCC SET 1 H
+        {1, 4, 0}, // 0xCD SET 1 L
+        {1, 12, 0}, // 0xCE SET 1 (HL)
+        {1, 4, 0}, // 0xCF SET 1 A
+        {1, 4, 0}, // 0xD0 SET 2 B
+        {1, 4, 0}, // 0xD1 SET 2 C
+        {1, 4, 0}, // 0xD2 SET 2 D
+        {1, 4, 0}, // 0xD3 SET 2 E
+        {1, 4, 0}, // 0xD4 SET 2 H
+        {1, 4, 0}, // 0xD5 SET 2 L
+        {1, 12, 0}, // 0xD6 SET 2 (HL)
+        {1, 4, 0}, // 0xD7 SET 2 A
+        {1, 4, 0}, // 0xD8 SET 3 B
+        {1, 4, 0}, // 0xD9 SET 3 C
+        {1, 4, 0}, // 0xDA SET 3 D
+        {1, 4, 0}, // 0xDB SET 3 E
+        {1, 4, 0}, // 0xDC SET 3 H
+        {1, 4, 0}, // 0xDD SET 3 L
+        {1, 12, 0}, // 0xDE SET 3 (HL)
+        {1, 4, 0}, // 0xDF SET 3 A
+        {1, 4, 0}, // 0xE0 SET 4 B
+        {1, 4, 0}, // 0xE1 SET 4 C
+        {1, 4, 0}, // 0xE2 SET 4 D
+        {1, 4, 0}, // 0xE3 SET 4 E
+        {1, 4, 0}, // 0xE4 SET 4 H
+        {1, 4, 0}, // 0xE5 SET 4 L
+        {1, 12, 0}, // 0xE6 SET 4 (HL)
+        {1, 4, 0}, // 0xE7 SET 4 A
+        {1, 4, 0}, // 0xE8 SET 5 B
+        {1, 4, 0}, // 0xE9 SET 5 C
+        {1, 4, 0}, // 0xEA SET 5 D
+        {1, 4, 0}, // 0xEB SET 5 E
+        {1, 4, 0}, // 0xEC SET 5 H
+        {1, 4, 0}, // 0xED SET 5 L
+        {1, 12, 0}, // 0xEE SET 5 (HL)
+        {1, 4, 0}, // 0xEF SET 5 A
+        {1, 4, 0}, // 0xF0 SET 6 B
+        {1, 4, 0}, // 0xF1 SET 6 C
+        {1, 4, 0}, // 0xF2 SET 6 D
+        {1, 4, 0}, // 0xF3 SET 6 E
+        {1, 4, 0}, // 0xF4 SET 6 H
+        {1, 4, 0}, // 0xF5 SET 6 L
+        {1, 12, 0}, // 0xF6 SET 6 (HL)
+        {1, 4, 0}, // 0xF7 SET 6 A
+        {1, 4, 0}, // 0xF8 SET 7 B
+        {1, 4, 0}, // 0xF9 SET 7 C
+        {1, 4, 0}, // 0xFA SET 7 D
+        {1, 4, 0}, // 0xFB SET 7 E
+        {1, 4, 0}, // 0xFC SET 7 H
+        {1, 4, 0}, // 0xFD SET 7 L
+        {1, 12, 0}, // 0xFE SET 7 (HL)
+        {1, 4, 0}, // 0xFF SET 7 A
+    }};
+
+    inline constexpr std::array<OpCodeDetails, 256> OPCODE_DETAILS_PREFIXED = {{
+        {"RLC", "B", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RLC", "C", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RLC", "D", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RLC", "E", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RLC", "H", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RLC", "L", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RLC", "(HL)", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RLC", "A", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RRC", "B", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RRC", "C", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RRC", "D", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RRC", "E", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RRC", "H", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RRC", "L", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RRC", "(HL)", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RRC", "A", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RL", "B", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RL", "C", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RL", "D", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RL", "E", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RL", "H", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RL", "L", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RL", "(HL)", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RL", "A", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RR", "B", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RR", "C", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RR", "D", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RR", "E", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RR", "H", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RR", "L", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RR", "(HL)", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"RR", "A", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SLA", "B", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SLA", "C", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SLA", "D", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SLA", "E", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SLA", "H", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SLA", "L", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SLA", "(HL)", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SLA", "A", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SRA", "B", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SRA", "C", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SRA", "D", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SRA", "E", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SRA", "H", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SRA", "L", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SRA", "(HL)", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SRA", "A", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SWAP", "B", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"SWAP", "C", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"SWAP", "D", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"SWAP", "E", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"SWAP", "H", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"SWAP", "L", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"SWAP", "(HL)", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"SWAP", "A", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::UNSET},
+        {"SRL", "B", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SRL", "C", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SRL", "D", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SRL", "E", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SRL", "H", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SRL", "L", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SRL", "(HL)", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"SRL", "A", "", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::UNSET, FlagEffect::CARRY},
+        {"BIT", "0", "B", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "0", "C", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "0", "D", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "0", "E", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "0", "H", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "0", "L", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "0", "(HL)", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "0", "A", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "1", "B", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "1", "C", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "1", "D", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "1", "E", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "1", "H", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "1", "L", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "1", "(HL)", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "1", "A", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "2", "B", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "2", "C", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "2", "D", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "2", "E", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "2", "H", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "2", "L", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "2", "(HL)", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "2", "A", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "3", "B", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "3", "C", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "3", "D", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "3", "E", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "3", "H", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "3", "L", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "3", "(HL)", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "3", "A", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "4", "B", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "4", "C", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "4", "D", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "4", "E", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "4", "H", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "4", "L", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "4", "(HL)", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "4", "A", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "5", "B", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "5", "C", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "5", "D", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "5", "E", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "5", "H", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "5", "L", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "5", "(HL)", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "5", "A", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "6", "B", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "6", "C", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "6", "D", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "6", "E", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "6", "H", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "6", "L", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "6", "(HL)", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "6", "A", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "7", "B", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "7", "C", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "7", "D", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "7", "E", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "7", "H", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "7", "L", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "7", "(HL)", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"BIT", "7", "A", FlagEffect::ZERO, FlagEffect::UNSET, FlagEffect::SET, FlagEffect::NONE},
+        {"RES", "0", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "0", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "0", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "0", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "0", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "0", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "0", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "0", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "1", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "1", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "1", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "1", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "1", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "1", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "1", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "1", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "2", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "2", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "2", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "2", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "2", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "2", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "2", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "2", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "3", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "3", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "3", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "3", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "3", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "3", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "3", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "3", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "4", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "4", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "4", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "4", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "4", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "4", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "4", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "4", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "5", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "5", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "5", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "5", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "5", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "5", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "5", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "5", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "6", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "6", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "6", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "6", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "6", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "6", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "6", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "6", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "7", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "7", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "7", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "7", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "7", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "7", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "7", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"RES", "7", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "0", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "0", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "0", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "0", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "0", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "0", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "0", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "0", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "1", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "1", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "1", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "1", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "1", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "1", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "1", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "1", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "2", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "2", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "2", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "2", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "2", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "2", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "2", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "2", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "3", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "3", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "3", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "3", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "3", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "3", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "3", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "3", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "4", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "4", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "4", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "4", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "4", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "4", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "4", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "4", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "5", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "5", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "5", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "5", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "5", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "5", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "5", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "5", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "6", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "6", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "6", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "6", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "6", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "6", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "6", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "6", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "7", "B", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "7", "C", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "7", "D", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "7", "E", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "7", "H", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "7", "L", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "7", "(HL)", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+        {"SET", "7", "A", FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE, FlagEffect::NONE},
+    }};
+
+    constexpr const OpCodeTiming& get_opcode_timing(uint8_t code) { return OPCODE_TIMINGS[code]; }
+
+    constexpr const OpCodeTiming& get_opcode_timing_prefixed(uint8_t code) {
+        return OPCODE_TIMINGS_PREFIXED[code];
+    }
 
-        case 0xF2:
-            return {false, 
-                    0xF2, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "(C)",
-                   };
+    constexpr OpCodeInfo make_opcode_info(bool prefixed, uint8_t code, const OpCodeTiming& timing,
+                                          const OpCodeDetails& details) {
+        return {prefixed,
+                code,
+                details.m_mnemonic,
+                timing.m_size,
+                timing.m_cycles,
+                timing.m_cyclesIfBranch ? std::optional<int>{timing.m_cyclesIfBranch} : std::nullopt,
+                details.m_flagZero,
+                details.m_flagSubtract,
+                details.m_flagHalfCarry,
+                details.m_flagCarry,
+                details.m_operandName1,
+                details.m_operandName2};
+    }
 
-        case 0xF3:
-            return {false, 
-                    0xF3, 
-                    "DI",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xF4:
-            return {false, 
-                    0xF4, 
-                    "ILLEGAL_F4",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xF5:
-            return {false, 
-                    0xF5, 
-                    "PUSH",
-                    1,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "AF",
-                    "",
-                   };
-
-        case 0xF6:
-            return {false, 
-                    0xF6, 
-                    "OR",
-                    2,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "u8",
-                   };
-
-        case 0xF7:
-            return {false, 
-                    0xF7, 
-                    "RST",
-                    1,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "30h",
-                    "",
-                   };
-
-        case 0xF8:
-            return {false, 
-                    0xF8, 
-                    "LD",
-                    2,
-                    12,
-                    {},
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "HL",
-                    "SP+",
-                   };
-
-        case 0xF9:
-            return {false, 
-                    0xF9, 
-                    "LD",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "SP",
-                    "HL",
-                   };
-
-        case 0xFA:
-            return {false, 
-                    0xFA, 
-                    "LD",
-                    3,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "A",
-                    "(a16)",
-                   };
-
-        case 0xFB:
-            return {false, 
-                    0xFB, 
-                    "EI",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xFC:
-            return {false, 
-                    0xFC, 
-                    "ILLEGAL_FC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xFD:
-            return {false, 
-                    0xFD, 
-                    "ILLEGAL_FD",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "",
-                    "",
-                   };
-
-        case 0xFE:
-            return {false, 
-                    0xFE, 
-                    "CP",
-                    2,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::SET,
-                    FlagEffect::HALF_CARRY,
-                    FlagEffect::CARRY,
-                    "A",
-                    "u8",
-                   };
-
-        case 0xFF:
-            return {false, 
-                    0xFF, 
-                    "RST",
-                    1,
-                    16,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "38h",
-                    "",
-                   };
-
-        default:
-            fail("Unknown OpCode: {}", code);
-        }
+    constexpr OpCodeInfo get_opcode_info(uint8_t code) {
+        return make_opcode_info(false, code, OPCODE_TIMINGS[code], OPCODE_DETAILS[code]);
     }
 
-
-    inline OpCodeInfo get_opcode_info_prefixed(uint8_t code) {
-
-        switch(code){
-
-        case 0x00:
-            return {true, 
-                    0x00, 
-                    "RLC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "B",
-                    "",
-                   };
-
-        case 0x01:
-            return {true, 
-                    0x01, 
-                    "RLC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "C",
-                    "",
-                   };
-
-        case 0x02:
-            return {true, 
-                    0x02, 
-                    "RLC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "D",
-                    "",
-                   };
-
-        case 0x03:
-            return {true, 
-                    0x03, 
-                    "RLC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "E",
-                    "",
-                   };
-
-        case 0x04:
-            return {true, 
-                    0x04, 
-                    "RLC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "H",
-                    "",
-                   };
-
-        case 0x05:
-            return {true, 
-                    0x05, 
-                    "RLC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "L",
-                    "",
-                   };
-
-        case 0x06:
-            return {true, 
-                    0x06, 
-                    "RLC",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "(HL)",
-                    "",
-                   };
-
-        case 0x07:
-            return {true, 
-                    0x07, 
-                    "RLC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "A",
-                    "",
-                   };
-
-        case 0x08:
-            return {true, 
-                    0x08, 
-                    "RRC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "B",
-                    "",
-                   };
-
-        case 0x09:
-            return {true, 
-                    0x09, 
-                    "RRC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "C",
-                    "",
-                   };
-
-        case 0x0A:
-            return {true, 
-                    0x0A, 
-                    "RRC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "D",
-                    "",
-                   };
-
-        case 0x0B:
-            return {true, 
-                    0x0B, 
-                    "RRC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "E",
-                    "",
-                   };
-
-        case 0x0C:
-            return {true, 
-                    0x0C, 
-                    "RRC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "H",
-                    "",
-                   };
-
-        case 0x0D:
-            return {true, 
-                    0x0D, 
-                    "RRC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "L",
-                    "",
-                   };
-
-        case 0x0E:
-            return {true, 
-                    0x0E, 
-                    "RRC",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "(HL)",
-                    "",
-                   };
-
-        case 0x0F:
-            return {true, 
-                    0x0F, 
-                    "RRC",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "A",
-                    "",
-                   };
-
-        case 0x10:
-            return {true, 
-                    0x10, 
-                    "RL",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "B",
-                    "",
-                   };
-
-        case 0x11:
-            return {true, 
-                    0x11, 
-                    "RL",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "C",
-                    "",
-                   };
-
-        case 0x12:
-            return {true, 
-                    0x12, 
-                    "RL",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "D",
-                    "",
-                   };
-
-        case 0x13:
-            return {true, 
-                    0x13, 
-                    "RL",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "E",
-                    "",
-                   };
-
-        case 0x14:
-            return {true, 
-                    0x14, 
-                    "RL",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "H",
-                    "",
-                   };
-
-        case 0x15:
-            return {true, 
-                    0x15, 
-                    "RL",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "L",
-                    "",
-                   };
-
-        case 0x16:
-            return {true, 
-                    0x16, 
-                    "RL",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "(HL)",
-                    "",
-                   };
-
-        case 0x17:
-            return {true, 
-                    0x17, 
-                    "RL",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "A",
-                    "",
-                   };
-
-        case 0x18:
-            return {true, 
-                    0x18, 
-                    "RR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "B",
-                    "",
-                   };
-
-        case 0x19:
-            return {true, 
-                    0x19, 
-                    "RR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "C",
-                    "",
-                   };
-
-        case 0x1A:
-            return {true, 
-                    0x1A, 
-                    "RR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "D",
-                    "",
-                   };
-
-        case 0x1B:
-            return {true, 
-                    0x1B, 
-                    "RR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "E",
-                    "",
-                   };
-
-        case 0x1C:
-            return {true, 
-                    0x1C, 
-                    "RR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "H",
-                    "",
-                   };
-
-        case 0x1D:
-            return {true, 
-                    0x1D, 
-                    "RR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "L",
-                    "",
-                   };
-
-        case 0x1E:
-            return {true, 
-                    0x1E, 
-                    "RR",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "(HL)",
-                    "",
-                   };
-
-        case 0x1F:
-            return {true, 
-                    0x1F, 
-                    "RR",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "A",
-                    "",
-                   };
-
-        case 0x20:
-            return {true, 
-                    0x20, 
-                    "SLA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "B",
-                    "",
-                   };
-
-        case 0x21:
-            return {true, 
-                    0x21, 
-                    "SLA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "C",
-                    "",
-                   };
-
-        case 0x22:
-            return {true, 
-                    0x22, 
-                    "SLA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "D",
-                    "",
-                   };
-
-        case 0x23:
-            return {true, 
-                    0x23, 
-                    "SLA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "E",
-                    "",
-                   };
-
-        case 0x24:
-            return {true, 
-                    0x24, 
-                    "SLA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "H",
-                    "",
-                   };
-
-        case 0x25:
-            return {true, 
-                    0x25, 
-                    "SLA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "L",
-                    "",
-                   };
-
-        case 0x26:
-            return {true, 
-                    0x26, 
-                    "SLA",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "(HL)",
-                    "",
-                   };
-
-        case 0x27:
-            return {true, 
-                    0x27, 
-                    "SLA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "A",
-                    "",
-                   };
-
-        case 0x28:
-            return {true, 
-                    0x28, 
-                    "SRA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "B",
-                    "",
-                   };
-
-        case 0x29:
-            return {true, 
-                    0x29, 
-                    "SRA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "C",
-                    "",
-                   };
-
-        case 0x2A:
-            return {true, 
-                    0x2A, 
-                    "SRA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "D",
-                    "",
-                   };
-
-        case 0x2B:
-            return {true, 
-                    0x2B, 
-                    "SRA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "E",
-                    "",
-                   };
-
-        case 0x2C:
-            return {true, 
-                    0x2C, 
-                    "SRA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "H",
-                    "",
-                   };
-
-        case 0x2D:
-            return {true, 
-                    0x2D, 
-                    "SRA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "L",
-                    "",
-                   };
-
-        case 0x2E:
-            return {true, 
-                    0x2E, 
-                    "SRA",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "(HL)",
-                    "",
-                   };
-
-        case 0x2F:
-            return {true, 
-                    0x2F, 
-                    "SRA",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "A",
-                    "",
-                   };
-
-        case 0x30:
-            return {true, 
-                    0x30, 
-                    "SWAP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "B",
-                    "",
-                   };
-
-        case 0x31:
-            return {true, 
-                    0x31, 
-                    "SWAP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "C",
-                    "",
-                   };
-
-        case 0x32:
-            return {true, 
-                    0x32, 
-                    "SWAP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "D",
-                    "",
-                   };
-
-        case 0x33:
-            return {true, 
-                    0x33, 
-                    "SWAP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "E",
-                    "",
-                   };
-
-        case 0x34:
-            return {true, 
-                    0x34, 
-                    "SWAP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "H",
-                    "",
-                   };
-
-        case 0x35:
-            return {true, 
-                    0x35, 
-                    "SWAP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "L",
-                    "",
-                   };
-
-        case 0x36:
-            return {true, 
-                    0x36, 
-                    "SWAP",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "(HL)",
-                    "",
-                   };
-
-        case 0x37:
-            return {true, 
-                    0x37, 
-                    "SWAP",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    "A",
-                    "",
-                   };
-
-        case 0x38:
-            return {true, 
-                    0x38, 
-                    "SRL",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "B",
-                    "",
-                   };
-
-        case 0x39:
-            return {true, 
-                    0x39, 
-                    "SRL",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "C",
-                    "",
-                   };
-
-        case 0x3A:
-            return {true, 
-                    0x3A, 
-                    "SRL",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "D",
-                    "",
-                   };
-
-        case 0x3B:
-            return {true, 
-                    0x3B, 
-                    "SRL",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "E",
-                    "",
-                   };
-
-        case 0x3C:
-            return {true, 
-                    0x3C, 
-                    "SRL",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "H",
-                    "",
-                   };
-
-        case 0x3D:
-            return {true, 
-                    0x3D, 
-                    "SRL",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "L",
-                    "",
-                   };
-
-        case 0x3E:
-            return {true, 
-                    0x3E, 
-                    "SRL",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "(HL)",
-                    "",
-                   };
-
-        case 0x3F:
-            return {true, 
-                    0x3F, 
-                    "SRL",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::UNSET,
-                    FlagEffect::CARRY,
-                    "A",
-                    "",
-                   };
-
-        case 0x40:
-            return {true, 
-                    0x40, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "0",
-                    "B",
-                   };
-
-        case 0x41:
-            return {true, 
-                    0x41, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "0",
-                    "C",
-                   };
-
-        case 0x42:
-            return {true, 
-                    0x42, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "0",
-                    "D",
-                   };
-
-        case 0x43:
-            return {true, 
-                    0x43, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "0",
-                    "E",
-                   };
-
-        case 0x44:
-            return {true, 
-                    0x44, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "0",
-                    "H",
-                   };
-
-        case 0x45:
-            return {true, 
-                    0x45, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "0",
-                    "L",
-                   };
-
-        case 0x46:
-            return {true, 
-                    0x46, 
-                    "BIT",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "0",
-                    "(HL)",
-                   };
-
-        case 0x47:
-            return {true, 
-                    0x47, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "0",
-                    "A",
-                   };
-
-        case 0x48:
-            return {true, 
-                    0x48, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "1",
-                    "B",
-                   };
-
-        case 0x49:
-            return {true, 
-                    0x49, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "1",
-                    "C",
-                   };
-
-        case 0x4A:
-            return {true, 
-                    0x4A, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "1",
-                    "D",
-                   };
-
-        case 0x4B:
-            return {true, 
-                    0x4B, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "1",
-                    "E",
-                   };
-
-        case 0x4C:
-            return {true, 
-                    0x4C, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "1",
-                    "H",
-                   };
-
-        case 0x4D:
-            return {true, 
-                    0x4D, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "1",
-                    "L",
-                   };
-
-        case 0x4E:
-            return {true, 
-                    0x4E, 
-                    "BIT",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "1",
-                    "(HL)",
-                   };
-
-        case 0x4F:
-            return {true, 
-                    0x4F, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "1",
-                    "A",
-                   };
-
-        case 0x50:
-            return {true, 
-                    0x50, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "2",
-                    "B",
-                   };
-
-        case 0x51:
-            return {true, 
-                    0x51, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "2",
-                    "C",
-                   };
-
-        case 0x52:
-            return {true, 
-                    0x52, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "2",
-                    "D",
-                   };
-
-        case 0x53:
-            return {true, 
-                    0x53, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "2",
-                    "E",
-                   };
-
-        case 0x54:
-            return {true, 
-                    0x54, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "2",
-                    "H",
-                   };
-
-        case 0x55:
-            return {true, 
-                    0x55, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "2",
-                    "L",
-                   };
-
-        case 0x56:
-            return {true, 
-                    0x56, 
-                    "BIT",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "2",
-                    "(HL)",
-                   };
-
-        case 0x57:
-            return {true, 
-                    0x57, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "2",
-                    "A",
-                   };
-
-        case 0x58:
-            return {true, 
-                    0x58, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "3",
-                    "B",
-                   };
-
-        case 0x59:
-            return {true, 
-                    0x59, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "3",
-                    "C",
-                   };
-
-        case 0x5A:
-            return {true, 
-                    0x5A, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "3",
-                    "D",
-                   };
-
-        case 0x5B:
-            return {true, 
-                    0x5B, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "3",
-                    "E",
-                   };
-
-        case 0x5C:
-            return {true, 
-                    0x5C, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "3",
-                    "H",
-                   };
-
-        case 0x5D:
-            return {true, 
-                    0x5D, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "3",
-                    "L",
-                   };
-
-        case 0x5E:
-            return {true, 
-                    0x5E, 
-                    "BIT",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "3",
-                    "(HL)",
-                   };
-
-        case 0x5F:
-            return {true, 
-                    0x5F, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "3",
-                    "A",
-                   };
-
-        case 0x60:
-            return {true, 
-                    0x60, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "4",
-                    "B",
-                   };
-
-        case 0x61:
-            return {true, 
-                    0x61, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "4",
-                    "C",
-                   };
-
-        case 0x62:
-            return {true, 
-                    0x62, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "4",
-                    "D",
-                   };
-
-        case 0x63:
-            return {true, 
-                    0x63, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "4",
-                    "E",
-                   };
-
-        case 0x64:
-            return {true, 
-                    0x64, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "4",
-                    "H",
-                   };
-
-        case 0x65:
-            return {true, 
-                    0x65, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "4",
-                    "L",
-                   };
-
-        case 0x66:
-            return {true, 
-                    0x66, 
-                    "BIT",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "4",
-                    "(HL)",
-                   };
-
-        case 0x67:
-            return {true, 
-                    0x67, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "4",
-                    "A",
-                   };
-
-        case 0x68:
-            return {true, 
-                    0x68, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "5",
-                    "B",
-                   };
-
-        case 0x69:
-            return {true, 
-                    0x69, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "5",
-                    "C",
-                   };
-
-        case 0x6A:
-            return {true, 
-                    0x6A, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "5",
-                    "D",
-                   };
-
-        case 0x6B:
-            return {true, 
-                    0x6B, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "5",
-                    "E",
-                   };
-
-        case 0x6C:
-            return {true, 
-                    0x6C, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "5",
-                    "H",
-                   };
-
-        case 0x6D:
-            return {true, 
-                    0x6D, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "5",
-                    "L",
-                   };
-
-        case 0x6E:
-            return {true, 
-                    0x6E, 
-                    "BIT",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "5",
-                    "(HL)",
-                   };
-
-        case 0x6F:
-            return {true, 
-                    0x6F, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "5",
-                    "A",
-                   };
-
-        case 0x70:
-            return {true, 
-                    0x70, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "6",
-                    "B",
-                   };
-
-        case 0x71:
-            return {true, 
-                    0x71, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "6",
-                    "C",
-                   };
-
-        case 0x72:
-            return {true, 
-                    0x72, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "6",
-                    "D",
-                   };
-
-        case 0x73:
-            return {true, 
-                    0x73, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "6",
-                    "E",
-                   };
-
-        case 0x74:
-            return {true, 
-                    0x74, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "6",
-                    "H",
-                   };
-
-        case 0x75:
-            return {true, 
-                    0x75, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "6",
-                    "L",
-                   };
-
-        case 0x76:
-            return {true, 
-                    0x76, 
-                    "BIT",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "6",
-                    "(HL)",
-                   };
-
-        case 0x77:
-            return {true, 
-                    0x77, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "6",
-                    "A",
-                   };
-
-        case 0x78:
-            return {true, 
-                    0x78, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "7",
-                    "B",
-                   };
-
-        case 0x79:
-            return {true, 
-                    0x79, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "7",
-                    "C",
-                   };
-
-        case 0x7A:
-            return {true, 
-                    0x7A, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "7",
-                    "D",
-                   };
-
-        case 0x7B:
-            return {true, 
-                    0x7B, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "7",
-                    "E",
-                   };
-
-        case 0x7C:
-            return {true, 
-                    0x7C, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "7",
-                    "H",
-                   };
-
-        case 0x7D:
-            return {true, 
-                    0x7D, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "7",
-                    "L",
-                   };
-
-        case 0x7E:
-            return {true, 
-                    0x7E, 
-                    "BIT",
-                    1,
-                    8,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "7",
-                    "(HL)",
-                   };
-
-        case 0x7F:
-            return {true, 
-                    0x7F, 
-                    "BIT",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::ZERO,
-                    FlagEffect::UNSET,
-                    FlagEffect::SET,
-                    FlagEffect::NONE,
-                    "7",
-                    "A",
-                   };
-
-        case 0x80:
-            return {true, 
-                    0x80, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "B",
-                   };
-
-        case 0x81:
-            return {true, 
-                    0x81, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "C",
-                   };
-
-        case 0x82:
-            return {true, 
-                    0x82, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "D",
-                   };
-
-        case 0x83:
-            return {true, 
-                    0x83, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "E",
-                   };
-
-        case 0x84:
-            return {true, 
-                    0x84, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "H",
-                   };
-
-        case 0x85:
-            return {true, 
-                    0x85, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "L",
-                   };
-
-        case 0x86:
-            return {true, 
-                    0x86, 
-                    "RES",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "(HL)",
-                   };
-
-        case 0x87:
-            return {true, 
-                    0x87, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "A",
-                   };
-
-        case 0x88:
-            return {true, 
-                    0x88, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "B",
-                   };
-
-        case 0x89:
-            return {true, 
-                    0x89, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "C",
-                   };
-
-        case 0x8A:
-            return {true, 
-                    0x8A, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "D",
-                   };
-
-        case 0x8B:
-            return {true, 
-                    0x8B, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "E",
-                   };
-
-        case 0x8C:
-            return {true, 
-                    0x8C, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "H",
-                   };
-
-        case 0x8D:
-            return {true, 
-                    0x8D, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "L",
-                   };
-
-        case 0x8E:
-            return {true, 
-                    0x8E, 
-                    "RES",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "(HL)",
-                   };
-
-        case 0x8F:
-            return {true, 
-                    0x8F, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "A",
-                   };
-
-        case 0x90:
-            return {true, 
-                    0x90, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "B",
-                   };
-
-        case 0x91:
-            return {true, 
-                    0x91, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "C",
-                   };
-
-        case 0x92:
-            return {true, 
-                    0x92, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "D",
-                   };
-
-        case 0x93:
-            return {true, 
-                    0x93, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "E",
-                   };
-
-        case 0x94:
-            return {true, 
-                    0x94, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "H",
-                   };
-
-        case 0x95:
-            return {true, 
-                    0x95, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "L",
-                   };
-
-        case 0x96:
-            return {true, 
-                    0x96, 
-                    "RES",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "(HL)",
-                   };
-
-        case 0x97:
-            return {true, 
-                    0x97, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "A",
-                   };
-
-        case 0x98:
-            return {true, 
-                    0x98, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "B",
-                   };
-
-        case 0x99:
-            return {true, 
-                    0x99, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "C",
-                   };
-
-        case 0x9A:
-            return {true, 
-                    0x9A, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "D",
-                   };
-
-        case 0x9B:
-            return {true, 
-                    0x9B, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "E",
-                   };
-
-        case 0x9C:
-            return {true, 
-                    0x9C, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "H",
-                   };
-
-        case 0x9D:
-            return {true, 
-                    0x9D, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "L",
-                   };
-
-        case 0x9E:
-            return {true, 
-                    0x9E, 
-                    "RES",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "(HL)",
-                   };
-
-        case 0x9F:
-            return {true, 
-                    0x9F, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "A",
-                   };
-
-        case 0xA0:
-            return {true, 
-                    0xA0, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "B",
-                   };
-
-        case 0xA1:
-            return {true, 
-                    0xA1, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "C",
-                   };
-
-        case 0xA2:
-            return {true, 
-                    0xA2, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "D",
-                   };
-
-        case 0xA3:
-            return {true, 
-                    0xA3, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "E",
-                   };
-
-        case 0xA4:
-            return {true, 
-                    0xA4, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "H",
-                   };
-
-        case 0xA5:
-            return {true, 
-                    0xA5, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "L",
-                   };
-
-        case 0xA6:
-            return {true, 
-                    0xA6, 
-                    "RES",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "(HL)",
-                   };
-
-        case 0xA7:
-            return {true, 
-                    0xA7, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "A",
-                   };
-
-        case 0xA8:
-            return {true, 
-                    0xA8, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "B",
-                   };
-
-        case 0xA9:
-            return {true, 
-                    0xA9, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "C",
-                   };
-
-        case 0xAA:
-            return {true, 
-                    0xAA, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "D",
-                   };
-
-        case 0xAB:
-            return {true, 
-                    0xAB, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "E",
-                   };
-
-        case 0xAC:
-            return {true, 
-                    0xAC, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "H",
-                   };
-
-        case 0xAD:
-            return {true, 
-                    0xAD, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "L",
-                   };
-
-        case 0xAE:
-            return {true, 
-                    0xAE, 
-                    "RES",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "(HL)",
-                   };
-
-        case 0xAF:
-            return {true, 
-                    0xAF, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "A",
-                   };
-
-        case 0xB0:
-            return {true, 
-                    0xB0, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "B",
-                   };
-
-        case 0xB1:
-            return {true, 
-                    0xB1, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "C",
-                   };
-
-        case 0xB2:
-            return {true, 
-                    0xB2, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "D",
-                   };
-
-        case 0xB3:
-            return {true, 
-                    0xB3, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "E",
-                   };
-
-        case 0xB4:
-            return {true, 
-                    0xB4, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "H",
-                   };
-
-        case 0xB5:
-            return {true, 
-                    0xB5, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "L",
-                   };
-
-        case 0xB6:
-            return {true, 
-                    0xB6, 
-                    "RES",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "(HL)",
-                   };
-
-        case 0xB7:
-            return {true, 
-                    0xB7, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "A",
-                   };
-
-        case 0xB8:
-            return {true, 
-                    0xB8, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "B",
-                   };
-
-        case 0xB9:
-            return {true, 
-                    0xB9, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "C",
-                   };
-
-        case 0xBA:
-            return {true, 
-                    0xBA, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "D",
-                   };
-
-        case 0xBB:
-            return {true, 
-                    0xBB, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "E",
-                   };
-
-        case 0xBC:
-            return {true, 
-                    0xBC, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "H",
-                   };
-
-        case 0xBD:
-            return {true, 
-                    0xBD, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "L",
-                   };
-
-        case 0xBE:
-            return {true, 
-                    0xBE, 
-                    "RES",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "(HL)",
-                   };
-
-        case 0xBF:
-            return {true, 
-                    0xBF, 
-                    "RES",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "A",
-                   };
-
-        case 0xC0:
-            return {true, 
-                    0xC0, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "B",
-                   };
-
-        case 0xC1:
-            return {true, 
-                    0xC1, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "C",
-                   };
-
-        case 0xC2:
-            return {true, 
-                    0xC2, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "D",
-                   };
-
-        case 0xC3:
-            return {true, 
-                    0xC3, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "E",
-                   };
-
-        case 0xC4:
-            return {true, 
-                    0xC4, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "H",
-                   };
-
-        case 0xC5:
-            return {true, 
-                    0xC5, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "L",
-                   };
-
-        case 0xC6:
-            return {true, 
-                    0xC6, 
-                    "SET",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "(HL)",
-                   };
-
-        case 0xC7:
-            return {true, 
-                    0xC7, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "0",
-                    "A",
-                   };
-
-        case 0xC8:
-            return {true, 
-                    0xC8, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "B",
-                   };
-
-        case 0xC9:
-            return {true, 
-                    0xC9, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "C",
-                   };
-
-        case 0xCA:
-            return {true, 
-                    0xCA, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "D",
-                   };
-
-        case 0xCB:
-            return {true, 
-                    0xCB, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "E",
-                   };
-
-        case 0xCC:
-            return {true, 
-                    0xCC, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "H",
-                   };
-
-        case 0xCD:
-            return {true, 
-                    0xCD, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "L",
-                   };
-
-        case 0xCE:
-            return {true, 
-                    0xCE, 
-                    "SET",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "(HL)",
-                   };
-
-        case 0xCF:
-            return {true, 
-                    0xCF, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "1",
-                    "A",
-                   };
-
-        case 0xD0:
-            return {true, 
-                    0xD0, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "B",
-                   };
-
-        case 0xD1:
-            return {true, 
-                    0xD1, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "C",
-                   };
-
-        case 0xD2:
-            return {true, 
-                    0xD2, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "D",
-                   };
-
-        case 0xD3:
-            return {true, 
-                    0xD3, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "E",
-                   };
-
-        case 0xD4:
-            return {true, 
-                    0xD4, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "H",
-                   };
-
-        case 0xD5:
-            return {true, 
-                    0xD5, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "L",
-                   };
-
-        case 0xD6:
-            return {true, 
-                    0xD6, 
-                    "SET",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "(HL)",
-                   };
-
-        case 0xD7:
-            return {true, 
-                    0xD7, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "2",
-                    "A",
-                   };
-
-        case 0xD8:
-            return {true, 
-                    0xD8, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "B",
-                   };
-
-        case 0xD9:
-            return {true, 
-                    0xD9, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "C",
-                   };
-
-        case 0xDA:
-            return {true, 
-                    0xDA, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "D",
-                   };
-
-        case 0xDB:
-            return {true, 
-                    0xDB, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "E",
-                   };
-
-        case 0xDC:
-            return {true, 
-                    0xDC, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "H",
-                   };
-
-        case 0xDD:
-            return {true, 
-                    0xDD, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "L",
-                   };
-
-        case 0xDE:
-            return {true, 
-                    0xDE, 
-                    "SET",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "(HL)",
-                   };
-
-        case 0xDF:
-            return {true, 
-                    0xDF, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "3",
-                    "A",
-                   };
-
-        case 0xE0:
-            return {true, 
-                    0xE0, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "B",
-                   };
-
-        case 0xE1:
-            return {true, 
-                    0xE1, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "C",
-                   };
-
-        case 0xE2:
-            return {true, 
-                    0xE2, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "D",
-                   };
-
-        case 0xE3:
-            return {true, 
-                    0xE3, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "E",
-                   };
-
-        case 0xE4:
-            return {true, 
-                    0xE4, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "H",
-                   };
-
-        case 0xE5:
-            return {true, 
-                    0xE5, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "L",
-                   };
-
-        case 0xE6:
-            return {true, 
-                    0xE6, 
-                    "SET",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "(HL)",
-                   };
-
-        case 0xE7:
-            return {true, 
-                    0xE7, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "4",
-                    "A",
-                   };
-
-        case 0xE8:
-            return {true, 
-                    0xE8, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "B",
-                   };
-
-        case 0xE9:
-            return {true, 
-                    0xE9, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "C",
-                   };
-
-        case 0xEA:
-            return {true, 
-                    0xEA, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "D",
-                   };
-
-        case 0xEB:
-            return {true, 
-                    0xEB, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "E",
-                   };
-
-        case 0xEC:
-            return {true, 
-                    0xEC, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "H",
-                   };
-
-        case 0xED:
-            return {true, 
-                    0xED, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "L",
-                   };
-
-        case 0xEE:
-            return {true, 
-                    0xEE, 
-                    "SET",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "(HL)",
-                   };
-
-        case 0xEF:
-            return {true, 
-                    0xEF, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "5",
-                    "A",
-                   };
-
-        case 0xF0:
-            return {true, 
-                    0xF0, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "B",
-                   };
-
-        case 0xF1:
-            return {true, 
-                    0xF1, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "C",
-                   };
-
-        case 0xF2:
-            return {true, 
-                    0xF2, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "D",
-                   };
-
-        case 0xF3:
-            return {true, 
-                    0xF3, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "E",
-                   };
-
-        case 0xF4:
-            return {true, 
-                    0xF4, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "H",
-                   };
-
-        case 0xF5:
-            return {true, 
-                    0xF5, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "L",
-                   };
-
-        case 0xF6:
-            return {true, 
-                    0xF6, 
-                    "SET",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "(HL)",
-                   };
-
-        case 0xF7:
-            return {true, 
-                    0xF7, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "6",
-                    "A",
-                   };
-
-        case 0xF8:
-            return {true, 
-                    0xF8, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "B",
-                   };
-
-        case 0xF9:
-            return {true, 
-                    0xF9, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "C",
-                   };
-
-        case 0xFA:
-            return {true, 
-                    0xFA, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "D",
-                   };
-
-        case 0xFB:
-            return {true, 
-                    0xFB, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "E",
-                   };
-
-        case 0xFC:
-            return {true, 
-                    0xFC, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "H",
-                   };
-
-        case 0xFD:
-            return {true, 
-                    0xFD, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "L",
-                   };
-
-        case 0xFE:
-            return {true, 
-                    0xFE, 
-                    "SET",
-                    1,
-                    12,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "(HL)",
-                   };
-
-        case 0xFF:
-            return {true, 
-                    0xFF, 
-                    "SET",
-                    1,
-                    4,
-                    {},
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    FlagEffect::NONE,
-                    "7",
-                    "A",
-                   };
-
-        default:
-            fail("Unknown OpCode: {}", code);
-        }
+    constexpr OpCodeInfo get_opcode_info_prefixed(uint8_t code) {
+        return make_opcode_info(
+            true, code, OPCODE_TIMINGS_PREFIXED[code], OPCODE_DETAILS_PREFIXED[code]);
     }
 
 
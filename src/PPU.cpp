@@ -1,11 +1,49 @@
 #include "PPU.h"
 #include "MiscOps.h"
+#include "TileDecode.h"
+#include <bit>
+#include <utility>
 
 namespace ez {
 
 PPU::PPU(IOReg& ioReg)
     : m_reg(ioReg) {
     reset();
+    update_palettes();
+}
+
+void PPU::update_palettes() {
+    const auto fill = [&](int offset, uint8_t palette) {
+        for (auto i = 0; i < PALETTE_COLORS; ++i) {
+            const auto shade = sample_palette(uint8_t(i), palette);
+            m_paletteShadeLut[offset + i] = shade;
+            m_paletteLut[offset + i] = m_displayColors[shade];
+        }
+    };
+    fill(BGP_LUT_OFFSET, m_reg->m_lcd.m_bgp);
+    fill(OBP0_LUT_OFFSET, m_reg->m_lcd.m_obp0);
+    fill(OBP1_LUT_OFFSET, m_reg->m_lcd.m_obp1);
+}
+
+void PPU::set_display_colors(const DisplayColors& colors) {
+    m_displayColors = colors;
+    update_palettes();
+}
+
+void PPU::set_display_format(DisplayFormat format) {
+    m_displayFormat = format;
+    m_display = m_displayOff;
+    m_displayOnLastVBlank = m_displayOff;
+    std::ranges::fill(m_displayIndices, 0);
+    std::ranges::fill(m_displayIndicesOnLastVBlank, 0);
+}
+
+void PPU::expand_display_indices(std::span<const uint8_t> indices, std::span<rgba8> dst) const {
+    ez_assert(dst.size() >= indices.size());
+    for (size_t i = 0; i < indices.size(); ++i) {
+        ez_assert(indices[i] < PALETTE_COLORS);
+        dst[i] = m_displayColors[indices[i]];
+    }
 }
 
 void PPU::write_addr(uint16_t addr, uint8_t data) {
@@ -17,6 +55,10 @@ void PPU::write_addr(uint16_t addr, uint8_t data) {
         const auto offset = addr - VRAM_ADDR_RANGE.m_min;
         EZ_ENSURE(size_t(offset) < VRAM_ADDR_RANGE.width());
         m_vram[offset] = data;
+        if (TILE_DATA_ADDR_RANGE.containsExclusive(addr)) {
+            const auto tileIdx = offset / BYTES_PER_TILE_COMPRESSED;
+            m_dirtyTiles[tileIdx / 64] |= uint64_t(1) << (tileIdx % 64);
+        }
     } else {
         EZ_ENSURE(OAM_ADDR_RANGE.containsExclusive(addr));
         if (!is_oam_avail_to_cpu()) {
@@ -84,9 +126,14 @@ void PPU::tick() {
                 ++m_reg->m_lcd.m_ly;
                 m_currentLineDotTickCount = 0;
                 if (m_reg->m_lcd.m_ly == DISPLAY_HEIGHT) {
-                    m_displayOnLastVBlank = m_display;
+                    if (m_displayFormat == DisplayFormat::INDEXED) {
+                        m_displayIndicesOnLastVBlank = m_displayIndices;
+                    } else {
+                        m_displayOnLastVBlank = m_display;
+                    }
+                    ++m_frameCount;
                     m_reg->m_lcd.m_status.m_ppuMode = +PPUMode::VBLANK;
-                    m_reg->m_if.vblank = true;
+                    m_reg->m_if.request(Interrupts::VBLANK);
                     if (m_reg->m_ie.lcd && m_reg->m_lcd.m_status.m_mode1InterruptSelect) {
                         set_stat_irq(StatIRQSources::MODE_1);
                     }
@@ -120,7 +167,63 @@ void PPU::tick() {
         statIRQ |= src;
     }
     if (update(m_statIRQ, statIRQ) && statIRQ) {
-        m_reg->m_if.lcd = true;
+        m_reg->m_if.request(Interrupts::LCD);
+    }
+}
+
+int PPU::get_dots_until_next_event() const {
+    if (!m_reg->m_lcd.m_control.m_ppuEnable) {
+        return std::numeric_limits<int>::max();
+    }
+    const auto eventDot = [&] {
+        switch (m_reg->m_lcd.m_status.m_ppuMode) {
+            case +PPUMode::OAM_SCAN: return 80;
+            case +PPUMode::DRAWING:  return 200;
+            default:                 return 456;
+        }
+    }();
+    // the counter only ever goes up, if it's already past the event it never fires
+    return eventDot > m_currentLineDotTickCount ? eventDot - m_currentLineDotTickCount
+                                           : std::numeric_limits<int>::max();
+}
+
+int PPU::get_dots_until_vblank() const {
+    const auto untilEvent = get_dots_until_next_event();
+    if (untilEvent == std::numeric_limits<int>::max()) {
+        return untilEvent;
+    }
+    // the OAM scan resets the line counter, so visible lines are 80 dots longer than vblank ones
+    static constexpr int visibleLineDots = 80 + 456;
+    static constexpr int vblankLineDots = 456;
+    const int ly = m_reg->m_lcd.m_ly;
+    const int linesAfterThis = DISPLAY_HEIGHT - 1 - ly;
+    switch (m_reg->m_lcd.m_status.m_ppuMode) {
+        case +PPUMode::OAM_SCAN: return untilEvent + 456 + linesAfterThis * visibleLineDots;
+        case +PPUMode::VBLANK:
+            return untilEvent + (153 - ly) * vblankLineDots + DISPLAY_HEIGHT * visibleLineDots;
+        default: // drawing and hblank share the line counter
+            return 456 - m_currentLineDotTickCount + linesAfterThis * visibleLineDots;
+    }
+}
+
+void PPU::tick_for(int dots) {
+    if (!m_reg->m_lcd.m_control.m_ppuEnable) {
+        return;
+    }
+    while (dots > 0) {
+        const auto untilEvent = get_dots_until_next_event();
+        // dots before the event only advance the counter and drop the stat IRQ line
+        const auto quietDots = std::min(dots, untilEvent - 1);
+        if (quietDots > 0) {
+            m_currentLineDotTickCount += quietDots;
+            m_statIRQSources = {};
+            m_statIRQ = false;
+            dots -= quietDots;
+        }
+        if (dots > 0) {
+            tick();
+            --dots;
+        }
     }
 }
 
@@ -138,7 +241,19 @@ std::span<const rgba8> PPU::get_display_framebuffer() const {
     }
 }
 
+void PPU::decode_dirty_tiles() {
+    for (size_t word = 0; word < m_dirtyTiles.size(); ++word) {
+        for (auto bits = std::exchange(m_dirtyTiles[word], 0); bits; bits &= bits - 1) {
+            const auto tileIdx = int(word * 64) + std::countr_zero(bits);
+            decode_2bpp_rows(m_vram.data() + tileIdx * BYTES_PER_TILE_COMPRESSED,
+                             TILE_DIM_XY,
+                             m_decodedTiles.data() + tileIdx * PIXELS_PER_TILE);
+        }
+    }
+}
+
 std::span<const rgba8> PPU::get_window_dbg_framebuffer() {
+    decode_dirty_tiles();
     for (int i = 0; i < BG_WINDOW_DIM_XY / TILE_DIM_XY; ++i) {
         render_bg_window_row(i, true, m_reg->m_lcd.m_control.m_windowTilemap, m_window.data());
     }
@@ -152,6 +267,7 @@ std::span<const rgba8> PPU::get_window_dbg_framebuffer() {
 }
 
 std::span<const rgba8> PPU::get_bg_dbg_framebuffer() {
+    decode_dirty_tiles();
     for (int i = 0; i < BG_WINDOW_DIM_XY / TILE_DIM_XY; ++i) {
         render_bg_window_row(i, true, m_reg->m_lcd.m_control.m_bgTilemap, m_bg.data());
     }
@@ -165,9 +281,9 @@ std::span<const rgba8> PPU::get_bg_dbg_framebuffer() {
 }
 
 std::span<const rgba8> PPU::get_vram_dbg_framebuffer() {
-    auto tile = std::vector<uint8_t>(TILE_DIM_XY * TILE_DIM_XY);
-    for (auto i = 0; i < 384; ++i) {
-        render_tile(m_vram.data() + i * BYTES_PER_TILE_COMPRESSED, tile.data(), TILE_DIM_XY);
+    decode_dirty_tiles();
+    for (auto i = 0; i < TILE_COUNT; ++i) {
+        const auto tile = get_decoded_tile(i);
         const auto dstRow = i / 16;
         const auto dstCol = i % 16;
         const auto bytesPerRow = 16 * TILE_DIM_XY * TILE_DIM_XY;
@@ -184,48 +300,16 @@ std::span<const rgba8> PPU::get_vram_dbg_framebuffer() {
 
 void PPU::set_stat_irq(StatIRQSources src) { m_statIRQSources[+src] = true; }
 
-void PPU::render_tile(const uint8_t* tileBegin, uint8_t* dst, int rowPitch) {
-    for (auto y = 0; y < TILE_DIM_XY; ++y) {
-        const auto byte0 = tileBegin[(y * 2)];
-        const auto byte1 = tileBegin[(y * 2) + 1];
-        for (auto x = 0; x < TILE_DIM_XY; ++x) {
-            const uint8_t bit0 = byte0 & (0b1000'0000 >> x) ? 0b1 : 0;
-            const uint8_t bit1 = byte1 & (0b1000'0000 >> x) ? 0b1 : 0;
-            const uint8_t px = bit1 << 1 | bit0;
-            ez_assert(px < 4);
-            dst[y * rowPitch + x] = px;
-        }
-    }
-}
-
 void PPU::update_scanline() {
 
     const auto y = m_reg->m_lcd.m_ly;
     const auto objHeight = m_reg->m_lcd.m_control.m_objSize ? 16 : 8;
 
-    // todo, don't draw the entire bg/window every line
-    update_bg_row(y);
-    update_window_row(y);
+    decode_dirty_tiles();
+    render_bg_window_line(y);
 
-    auto renderedTile = std::vector<uint8_t>(TILE_DIM_XY * TILE_DIM_XY);
     for (auto x = 0; x < DISPLAY_WIDTH; ++x) {
-
-        const auto bgY = (y + m_reg->m_lcd.m_scy) % BG_WINDOW_DIM_XY;
-        const auto bgX = (x + m_reg->m_lcd.m_scx) % BG_WINDOW_DIM_XY;
-
-        const auto windowLeft = m_reg->m_lcd.m_windowXPlus7 - 7;
-        const auto windowTop = m_reg->m_lcd.m_windowY;
-        const auto wX = x - windowLeft;
-        const auto wY = y - windowTop;
-
-        const bool inWindow =
-            m_reg->m_lcd.m_control.m_windowEnable &&
-            iRange{windowLeft, windowLeft + BG_WINDOW_DIM_XY}.containsExclusive(x) &&
-            iRange{windowTop, windowTop + BG_WINDOW_DIM_XY}.containsExclusive(y);
-
-        auto bgPaletteIdx =
-            inWindow ? m_window[wY * BG_WINDOW_DIM_XY + wX] : m_bg[bgY * BG_WINDOW_DIM_XY + bgX];
-        const auto bgColorIdx = sample_palette(bgPaletteIdx, m_reg->m_lcd.m_bgp);
+        const auto bgPaletteIdx = m_bgWindowLine[x];
         uint8_t spritePaletteIdx = 0;
         auto spritePriority = false;
         auto spritePalette = false;
@@ -251,10 +335,8 @@ void PPU::update_scanline() {
             } else if (!isTopTile) {
                 tileIdx |= 0x01;
             }
-            render_tile(m_vram.data() + tileIdx * BYTES_PER_TILE_COMPRESSED,
-                        renderedTile.data(),
-                        TILE_DIM_XY);
-            spritePaletteIdx = renderedTile[(spriteY % TILE_DIM_XY) * TILE_DIM_XY + spriteX];
+            const auto tile = get_decoded_tile(tileIdx);
+            spritePaletteIdx = tile[(spriteY % TILE_DIM_XY) * TILE_DIM_XY + spriteX];
             spritePriority = sprite.m_attributes.m_priority;
             spritePalette = sprite.m_attributes.m_palette;
             ez_assert(spritePaletteIdx < 4);
@@ -262,13 +344,26 @@ void PPU::update_scanline() {
                 break;
             }
         }
+        // priority sprites are behind BG colour index 1-3, whatever BGP maps them to
         const bool useSpritePx =
-            (spritePaletteIdx != 0) && (spritePriority ? bgColorIdx == 0 : true);
+            (spritePaletteIdx != 0) && (spritePriority ? bgPaletteIdx == 0 : true);
 
-        const auto spriteColorIdx = sample_palette(
-            spritePaletteIdx, spritePalette ? m_reg->m_lcd.m_obp1 : m_reg->m_lcd.m_obp0);
-        const auto color = get_color(useSpritePx ? spriteColorIdx : bgColorIdx);
-        m_display[y * DISPLAY_WIDTH + x] = color;
+        const auto spriteLutOffset = spritePalette ? OBP1_LUT_OFFSET : OBP0_LUT_OFFSET;
+        m_lineLutIdx[x] = uint8_t(useSpritePx ? spriteLutOffset + spritePaletteIdx
+                                              : BGP_LUT_OFFSET + bgPaletteIdx);
+    }
+
+    // one table load a pixel, the palettes were applied when they were written
+    if (m_displayFormat == DisplayFormat::INDEXED) {
+        auto* const dst = m_displayIndices.data() + y * DISPLAY_WIDTH;
+        for (auto x = 0; x < DISPLAY_WIDTH; ++x) {
+            dst[x] = m_paletteShadeLut[m_lineLutIdx[x]];
+        }
+    } else {
+        auto* const dst = m_display.data() + y * DISPLAY_WIDTH;
+        for (auto x = 0; x < DISPLAY_WIDTH; ++x) {
+            dst[x] = m_paletteLut[m_lineLutIdx[x]];
+        }
     }
 }
 
@@ -313,27 +408,60 @@ void PPU::do_oam_scan() {
               useCgbSpriteOrdering ? cgbSpriteOrder : dmgSpriteOrder);
 }
 
-void PPU::update_bg_row(int y) {
-    const auto bgY = (y + m_reg->m_lcd.m_scy) % BG_WINDOW_DIM_XY;
-    const auto tileY = bgY / TILE_DIM_XY;
+const uint8_t* PPU::get_bg_window_tile(uint8_t tileIdx) const {
+    if (m_reg->m_lcd.m_control.m_bgWindowTileAddrMode) {
+        return get_decoded_tile(tileIdx);
+    } else {
+        // 0x9000 is tile 256
+        return get_decoded_tile(256 + static_cast<int8_t>(tileIdx));
+    }
+}
 
-    render_bg_window_row(tileY,
-                         m_reg->m_lcd.m_control.m_bgWindowEnable,
-                         m_reg->m_lcd.m_control.m_bgTilemap,
-                         m_bg.data());
+const uint8_t* PPU::get_tile_map_row(bool tileMap, int tileX, int tileY, int pxY) const {
+    static constexpr auto tilesPerRow = BG_WINDOW_DIM_XY / TILE_DIM_XY;
+    const auto tileMapOffset = (tileMap ? 0x9C00 : 0x9800) - VRAM_ADDR_RANGE.m_min;
+    const auto tileIdx = m_vram[tileMapOffset + tileY * tilesPerRow + tileX];
+    return get_bg_window_tile(tileIdx) + pxY * TILE_DIM_XY;
 }
 
-void PPU::update_window_row(int y) {
+void PPU::render_bg_window_line(int y) {
+    const auto& lcd = m_reg->m_lcd;
+    if (!lcd.m_control.m_bgWindowEnable) {
+        m_bgWindowLine = {};
+        return;
+    }
 
-    const auto windowTop = m_reg->m_lcd.m_windowY;
-    const auto windowY = (BG_WINDOW_DIM_XY + y - windowTop) % BG_WINDOW_DIM_XY;
-    const auto tileY = windowY / TILE_DIM_XY;
+    // only the tiles the line crosses, fetching the next one as x reaches its left edge
+    const auto bgY = (y + lcd.m_scy) % BG_WINDOW_DIM_XY;
+    const uint8_t* row = nullptr;
+    for (auto x = 0; x < DISPLAY_WIDTH; ++x) {
+        const auto bgX = (x + lcd.m_scx) % BG_WINDOW_DIM_XY;
+        if (!row || bgX % TILE_DIM_XY == 0) {
+            row = get_tile_map_row(lcd.m_control.m_bgTilemap,
+                                   bgX / TILE_DIM_XY,
+                                   bgY / TILE_DIM_XY,
+                                   bgY % TILE_DIM_XY);
+        }
+        m_bgWindowLine[x] = row[bgX % TILE_DIM_XY];
+    }
 
-    render_bg_window_row(tileY,
-                         m_reg->m_lcd.m_control.m_windowEnable &&
-                             m_reg->m_lcd.m_control.m_bgWindowEnable,
-                         m_reg->m_lcd.m_control.m_windowTilemap,
-                         m_window.data());
+    // the window covers everything right of WX - 7, from WY down
+    const auto windowLeft = lcd.m_windowXPlus7 - 7;
+    const auto windowY = y - lcd.m_windowY;
+    if (!lcd.m_control.m_windowEnable || windowY < 0 || windowLeft >= DISPLAY_WIDTH) {
+        return;
+    }
+    row = nullptr;
+    for (auto x = std::max(windowLeft, 0); x < DISPLAY_WIDTH; ++x) {
+        const auto windowX = x - windowLeft;
+        if (!row || windowX % TILE_DIM_XY == 0) {
+            row = get_tile_map_row(lcd.m_control.m_windowTilemap,
+                                   windowX / TILE_DIM_XY,
+                                   windowY / TILE_DIM_XY,
+                                   windowY % TILE_DIM_XY);
+        }
+        m_bgWindowLine[x] = row[windowX % TILE_DIM_XY];
+    }
 }
 
 void PPU::render_bg_window_row(int tileY, bool enable, bool tileMap, uint8_t* dst) {
@@ -345,41 +473,18 @@ void PPU::render_bg_window_row(int tileY, bool enable, bool tileMap, uint8_t* ds
 
     const auto tileMapOffset = (tileMap ? 0x9C00 : 0x9800) - VRAM_ADDR_RANGE.m_min;
 
-    const auto getTilePtr = [&](uint8_t tileIdx) {
-        if (m_reg->m_lcd.m_control.m_bgWindowTileAddrMode) {
-            const auto offset =
-                (0x8000 - VRAM_ADDR_RANGE.m_min) + (tileIdx * BYTES_PER_TILE_COMPRESSED);
-            return m_vram.data() + offset;
-        } else {
-            const int signedIdx = static_cast<int8_t>(tileIdx);
-            const auto offset =
-                (0x9000 - VRAM_ADDR_RANGE.m_min) + (signedIdx * BYTES_PER_TILE_COMPRESSED);
-            return m_vram.data() + offset;
-        }
-    };
     const auto tilesPerRow = BG_WINDOW_DIM_XY / TILE_DIM_XY;
-    auto renderedTile = std::vector<uint8_t>(TILE_DIM_XY * TILE_DIM_XY);
     for (auto tileX = 0; tileX < tilesPerRow; ++tileX) {
         const auto tileIdx = m_vram[tileMapOffset + (tileY * tilesPerRow) + tileX];
-        const auto tilePtr = getTilePtr(tileIdx);
-        render_tile(tilePtr, renderedTile.data(), 8);
+        const auto tile = get_bg_window_tile(tileIdx);
         for (auto tilePxY = 0; tilePxY < TILE_DIM_XY; ++tilePxY) {
             auto dstPtr =
                 dst + ((tileY * TILE_DIM_XY + tilePxY) * BG_WINDOW_DIM_XY) + tileX * TILE_DIM_XY;
-            for (auto tilePxX = 0; tilePxX < TILE_DIM_XY; ++tilePxX) {
-                dstPtr[tilePxX] = renderedTile[tilePxY * TILE_DIM_XY + tilePxX];
-            }
+            memcpy(dstPtr, tile + tilePxY * TILE_DIM_XY, TILE_DIM_XY);
         }
     }
 }
 
-bool PPU::is_vram_avail_to_cpu() const {
-    if (m_reg->m_lcd.m_control.m_ppuEnable == false) {
-        return true;
-    }
-    return m_reg->m_lcd.m_status.m_ppuMode != +PPUMode::DRAWING;
-}
-
 void PPU::reset() {
     // todo, verify this is all the resets when LCD is disabled
     log_warn("PPU Reset!");
@@ -391,6 +496,8 @@ void PPU::reset() {
 
     m_display = m_displayOff;
     m_displayOnLastVBlank = m_displayOff;
+    std::ranges::fill(m_displayIndices, 0);
+    std::ranges::fill(m_displayIndicesOnLastVBlank, 0);
 }
 
 bool PPU::is_oam_avail_to_cpu() const {
@@ -402,23 +509,13 @@ bool PPU::is_oam_avail_to_cpu() const {
 }
 
 rgba8 PPU::get_bg_color(const uint8_t paletteIdx) const {
-    ez_assert(paletteIdx < 4);
-
-    const auto bgp = m_reg->m_lcd.m_bgp;
-    const uint8_t colorIdx = ((0b11 << (2 * paletteIdx)) & bgp) >> (2 * paletteIdx);
-    return get_color(colorIdx);
+    ez_assert(paletteIdx < PALETTE_COLORS);
+    return m_paletteLut[BGP_LUT_OFFSET + paletteIdx];
 }
 
 rgba8 PPU::get_color(const uint8_t colorIdx) const {
-    static constexpr std::array<rgba8, 4> colors{
-        rgba8{0xb2, 0xb4, 0xb9, 0xFF},
-        rgba8{0x60, 0x96, 0x9f, 0xFF},
-        rgba8{0x26, 0x5a, 0x37, 0xFF},
-        rgba8{0x3d, 0x2e, 0x00, 0xFF},
-    };
-
-    ez_assert(colorIdx < 4);
-    return colors[colorIdx];
+    ez_assert(colorIdx < PALETTE_COLORS);
+    return m_displayColors[colorIdx];
 }
 
 void PPU::update_ly_eq_lyc() {
@@ -27,6 +27,14 @@ struct alignas(uint8_t) ObjectAttribute {
 };
 static_assert(sizeof(ObjectAttribute) == 4);
 
+// what the PPU writes for each pixel. INDEXED is a byte per pixel holding the shade (0-3, lightest
+// first) the palettes picked, a quarter of the size, for consumers that don't need colours or
+// expand them themselves with PPU::expand_display_indices
+enum class DisplayFormat {
+    RGBA8,
+    INDEXED,
+};
+
 class PPU {
 
   public:
@@ -37,21 +45,81 @@ class PPU {
     static constexpr int TILE_DIM_XY = 8;
     static constexpr int BYTES_PER_TILE_COMPRESSED = 16;
     static constexpr iRange VRAM_ADDR_RANGE = {0x8000, 0xA000};
+    static constexpr iRange TILE_DATA_ADDR_RANGE = {0x8000, 0x9800};
+    static constexpr int TILE_COUNT = TILE_DATA_ADDR_RANGE.width() / BYTES_PER_TILE_COMPRESSED;
+    static constexpr int PIXELS_PER_TILE = TILE_DIM_XY * TILE_DIM_XY;
     static constexpr iRange OAM_ADDR_RANGE = {0xFE00, 0xFEA0};
+    static constexpr iRange LCD_IO_ADDR_RANGE = {0xFF40, 0xFF4C}; // LCDC through WX
 
     static constexpr int VRAM_DEBUG_FB_WIDTH = 16 * TILE_DIM_XY;
     static constexpr int VRAM_DEBUG_FB_HEIGHT = 24 * TILE_DIM_XY;
 
+    static constexpr int DOTS_PER_FRAME = 70'224;
+
     static constexpr int OAM_SPRITE_COUNT = OAM_ADDR_RANGE.width() / int(sizeof(ObjectAttribute));
 
+    static constexpr int PALETTE_COLORS = 4;
+    // where each palette's colours start in m_paletteLut
+    static constexpr int BGP_LUT_OFFSET = 0;
+    static constexpr int OBP0_LUT_OFFSET = PALETTE_COLORS;
+    static constexpr int OBP1_LUT_OFFSET = 2 * PALETTE_COLORS;
+    using DisplayColors = std::array<rgba8, PALETTE_COLORS>;
+    static constexpr DisplayColors DEFAULT_DISPLAY_COLORS = {
+        rgba8{0xb2, 0xb4, 0xb9, 0xFF},
+        rgba8{0x60, 0x96, 0x9f, 0xFF},
+        rgba8{0x26, 0x5a, 0x37, 0xFF},
+        rgba8{0x3d, 0x2e, 0x00, 0xFF},
+    };
+
     PPU(IOReg& io);
 
     void tick();
+    // same as calling tick() dots times, but jumps straight between mode changes and LY increments
+    void tick_for(int dots);
+    // dots until the next mode change or LY increment, int max if the PPU is off
+    int get_dots_until_next_event() const;
+    // dots until the PPU next enters vblank, int max if the PPU is off
+    int get_dots_until_vblank() const;
+    // number of times the PPU has entered vblank
+    int64_t get_frame_count() const { return m_frameCount; }
+    bool is_enabled() const { return m_reg->m_lcd.m_control.m_ppuEnable; }
 
     uint8_t read_addr(uint16_t) const;
     void write_addr(uint16_t, uint8_t);
 
+    // the last full frame, only written in DisplayFormat::RGBA8
     std::span<const rgba8> get_display_framebuffer() const;
+    // the last full frame as shades, only written in DisplayFormat::INDEXED
+    std::span<const uint8_t> get_display_indices() const { return m_displayIndicesOnLastVBlank; }
+    // shades from get_display_indices to the current display colours
+    void expand_display_indices(std::span<const uint8_t> indices, std::span<rgba8> dst) const;
+
+    DisplayFormat get_display_format() const { return m_displayFormat; }
+    // blanks both framebuffers as if the LCD was off
+    void set_display_format(DisplayFormat format);
+
+    // rebuilds the palette LUTs, call after BGP, OBP0 or OBP1 change
+    void update_palettes();
+    // the four shades the DMG colour indices are shown as, lightest first
+    void set_display_colors(const DisplayColors& colors);
+    const DisplayColors& get_display_colors() const { return m_displayColors; }
+
+    bool is_vram_avail_to_cpu() const {
+        return !m_reg->m_lcd.m_control.m_ppuEnable ||
+               m_reg->m_lcd.m_status.m_ppuMode != +PPUMode::DRAWING;
+    }
+    // for the CPU memory map, only valid while is_vram_avail_to_cpu()
+    const uint8_t* get_vram_ptr(uint16_t addr) const {
+        return m_vram.data() + (addr - VRAM_ADDR_RANGE.m_min);
+    }
+    // writable pointers only for the tile maps, tile data writes go through write_addr so the
+    // decoded tiles stay in step
+    uint8_t* get_tile_map_ptr(uint16_t addr) {
+        ez_assert(!TILE_DATA_ADDR_RANGE.containsExclusive(addr));
+        return m_vram.data() + (addr - VRAM_ADDR_RANGE.m_min);
+    }
+    // for OAM DMA, which writes OAM whatever mode the PPU is in
+    uint8_t* get_oam_ptr() { return m_oam.data(); }
 
     // for debug only
     std::span<const rgba8> get_window_dbg_framebuffer();
@@ -64,21 +132,30 @@ class PPU {
     rgba8 get_bg_color(const uint8_t paletteIdx) const;
     rgba8 get_color(const uint8_t paletteIdx) const;
 
-    bool is_vram_avail_to_cpu() const;
     bool is_oam_avail_to_cpu() const;
     void set_stat_irq(StatIRQSources src);
     void update_ly_eq_lyc();
     void update_scanline();
     void do_oam_scan();
 
-    static void render_tile(const uint8_t* tileBegin, uint8_t* dst, int rowPitch);
-
+    // the tiles written since the last call, eight rows at a time so they go through the SIMD path
+    void decode_dirty_tiles();
+    // tileIdx counts from 0x8000, the 8800 addressing mode's tiles are 256 and up, only up to date
+    // after decode_dirty_tiles()
+    const uint8_t* get_decoded_tile(int tileIdx) const {
+        return m_decodedTiles.data() + tileIdx * PIXELS_PER_TILE;
+    }
+
+    // the decoded tile a BG/window tile map entry refers to, in the current addressing mode
+    const uint8_t* get_bg_window_tile(uint8_t tileIdx) const;
+    const uint8_t* get_tile_map_row(bool tileMap, int tileX, int tileY, int pxY) const;
+    // the BG and window colour indices (before BGP) of the visible pixels on line y
+    void render_bg_window_line(int y);
+    // a whole row of tiles of a 256x256 layer, only for the debug views
     void render_bg_window_row(int tileY, bool enable, bool tileMap, uint8_t* dst);
 
-    void update_bg_row(int line);
-    void update_window_row(int line);
-
     int m_currentLineDotTickCount = 0;
+    int64_t m_frameCount = 0;
 
     std::array<bool, +StatIRQSources::NUM_SOURCES> m_statIRQSources{};
     bool m_statIRQ = false;
@@ -89,14 +166,34 @@ class PPU {
     using ObjAndIdx = std::pair<ObjectAttribute, int>;
     std::vector<ObjAndIdx> m_spritesAndOamIdxOnLine;
 
+    std::array<uint8_t, DISPLAY_WIDTH> m_bgWindowLine{};
+    // each visible pixel on the line as an index into m_paletteLut
+    std::array<uint8_t, DISPLAY_WIDTH> m_lineLutIdx{};
+
+    DisplayColors m_displayColors = DEFAULT_DISPLAY_COLORS;
+    // BGP, OBP0 then OBP1, each colour index already through its palette to a display colour
+    std::array<rgba8, 3 * PALETTE_COLORS> m_paletteLut{};
+    // the same, stopping at the shade
+    std::array<uint8_t, 3 * PALETTE_COLORS> m_paletteShadeLut{};
+
+    DisplayFormat m_displayFormat = DisplayFormat::RGBA8;
+
+    // whole layers for the debug views
     std::vector<uint8_t> m_bg = std::vector<uint8_t>(BG_WINDOW_DIM_XY * BG_WINDOW_DIM_XY);
     std::vector<uint8_t> m_window = std::vector<uint8_t>(BG_WINDOW_DIM_XY * BG_WINDOW_DIM_XY);
 
     std::vector<uint8_t> m_vram = std::vector<uint8_t>(VRAM_ADDR_RANGE.width());
+    // every tile in TILE_DATA_ADDR_RANGE decoded, a whole tile at a time before the next line after
+    // it's written. A write only sets the tile's bit, a game loading tiles writes all 16 bytes
+    std::vector<uint8_t> m_decodedTiles = std::vector<uint8_t>(TILE_COUNT * PIXELS_PER_TILE);
+    std::array<uint64_t, (TILE_COUNT + 63) / 64> m_dirtyTiles{};
     std::vector<uint8_t> m_oam = std::vector<uint8_t>(OAM_ADDR_RANGE.width());
 
     std::vector<rgba8> m_display = std::vector<rgba8>(size_t(DISPLAY_WIDTH * DISPLAY_HEIGHT));
     std::vector<rgba8> m_displayOnLastVBlank = std::vector<rgba8>(size_t(DISPLAY_WIDTH * DISPLAY_HEIGHT));
+    // there's no shade for the LCD being off, it's blanked to the lightest
+    std::vector<uint8_t> m_displayIndices = std::vector<uint8_t>(size_t(DISPLAY_WIDTH * DISPLAY_HEIGHT));
+    std::vector<uint8_t> m_displayIndicesOnLastVBlank = std::vector<uint8_t>(size_t(DISPLAY_WIDTH * DISPLAY_HEIGHT));
 
     std::vector<rgba8> m_windowDebugFramebuffer = std::vector<rgba8>(size_t(BG_WINDOW_DIM_XY * BG_WINDOW_DIM_XY));
     std::vector<rgba8> m_bgDebugFramebuffer = std::vector<rgba8>(size_t(BG_WINDOW_DIM_XY * BG_WINDOW_DIM_XY));
@@ -27,6 +27,7 @@
     #define EZ_MSVC_WARN_POP() __pragma(warning(pop))
     #define EZ_MSVC_WARN_DISABLE(PP_ERROR_NO) __pragma(warning(disable : PP_ERROR_NO))
     #define EZ_DEBUG_BREAK() DebugBreak()
+    #define EZ_FORCE_INLINE __forceinline
 
 EZ_MSVC_WARN_DISABLE(4201) // we're using anonymous structs/unions extensively
 #else
@@ -35,6 +36,7 @@ EZ_MSVC_WARN_DISABLE(4201) // we're using anonymous structs/unions extensively
     #define EZ_MSVC_WARN_POP()
     #define EZ_MSVC_WARN_DISABLE(PP_ERROR_NO)
     #define EZ_DEBUG_BREAK() raise(SIGTRAP)
+    #define EZ_FORCE_INLINE inline __attribute__((always_inline))
 
 #endif
 
@@ -0,0 +1,140 @@
+#include "Profiler.h"
+#include "OpCodes.h"
+#include <algorithm>
+
+namespace ez {
+
+namespace {
+
+constexpr size_t ROM_BANK_BYTES = 0x4000;
+constexpr size_t ADDRESS_SLOTS = 0x10000;
+
+std::string format_mnemonic(uint8_t opcode, bool prefixed) {
+    const auto& details = prefixed ? OPCODE_DETAILS_PREFIXED[opcode] : OPCODE_DETAILS[opcode];
+    auto mnemonic = std::format("{} {} {}", details.m_mnemonic, details.m_operandName1,
+                                details.m_operandName2);
+    mnemonic.erase(mnemonic.find_last_not_of(' ') + 1);
+    return mnemonic;
+}
+
+double percent_of(int64_t part, int64_t total) {
+    return total > 0 ? 100.0 * double(part) / double(total) : 0.0;
+}
+
+} // namespace
+
+Profiler::Profiler(size_t romBytes)
+    : m_romBytes(romBytes),
+      m_cycles(romBytes + ADDRESS_SLOTS),
+      m_hits(romBytes + ADDRESS_SLOTS),
+      m_opcodes(romBytes + ADDRESS_SLOTS) {}
+
+void Profiler::reset() {
+    std::ranges::fill(m_cycles, 0);
+    std::ranges::fill(m_hits, 0);
+    m_opcodeCycles = {};
+    m_opcodeHits = {};
+    m_totalCycles = 0;
+    m_totalHits = 0;
+}
+
+std::vector<Profiler::Location> Profiler::get_hot_spots(size_t maxCount) const {
+    auto hotSpots = std::vector<Location>{};
+    for (size_t slot = 0; slot < m_hits.size(); ++slot) {
+        if (m_hits[slot] == 0) {
+            continue;
+        }
+        auto location = Location{};
+        if (slot < m_romBytes) {
+            location.m_bank = int(slot / ROM_BANK_BYTES);
+            const auto bankOffset = slot % ROM_BANK_BYTES;
+            location.m_pc = uint16_t(slot < ROM_BANK_BYTES ? slot : ROM_BANK_BYTES + bankOffset);
+        } else {
+            location.m_pc = uint16_t(slot - m_romBytes);
+        }
+        location.m_opcode = uint8_t(m_opcodes[slot]);
+        location.m_prefixed = m_opcodes[slot] >= 256;
+        location.m_cycles = int64_t(m_cycles[slot]);
+        location.m_hits = int64_t(m_hits[slot]);
+        hotSpots.push_back(location);
+    }
+
+    const auto count = std::min(maxCount, hotSpots.size());
+    std::ranges::partial_sort(hotSpots, hotSpots.begin() + count, std::greater{},
+                              &Location::m_cycles);
+    hotSpots.resize(count);
+    return hotSpots;
+}
+
+std::vector<Profiler::OpCode> Profiler::get_opcodes() const {
+    auto opcodes = std::vector<OpCode>{};
+    for (int slot = 0; slot < OPCODE_SLOTS; ++slot) {
+        if (m_opcodeHits[slot] > 0) {
+            opcodes.push_back({uint8_t(slot), slot >= 256, int64_t(m_opcodeCycles[slot]),
+                               int64_t(m_opcodeHits[slot])});
+        }
+    }
+    std::ranges::stable_sort(opcodes, std::greater{}, &OpCode::m_cycles);
+    return opcodes;
+}
+
+std::string Profiler::to_json(size_t maxHotSpots) const {
+    auto json = std::format("{{\n  \"total_cycles\": {},\n  \"instructions\": {},\n", m_totalCycles,
+                            m_totalHits);
+
+    json += "  \"hot_spots\": [";
+    const auto hotSpots = get_hot_spots(maxHotSpots);
+    for (size_t i = 0; i < hotSpots.size(); ++i) {
+        const auto& spot = hotSpots[i];
+        json += std::format("{}\n    {{\"bank\": {}, \"pc\": \"{:04x}\", \"instruction\": \"{}\", "
+                            "\"cycles\": {}, \"hits\": {}, \"percent\": {:.3f}}}",
+                            i == 0 ? "" : ",",
+                            spot.m_bank == NO_BANK ? "null" : std::to_string(spot.m_bank),
+                            spot.m_pc, format_mnemonic(spot.m_opcode, spot.m_prefixed),
+                            spot.m_cycles, spot.m_hits, percent_of(spot.m_cycles, m_totalCycles));
+    }
+    json += "\n  ],\n";
+
+    json += "  \"opcodes\": [";
+    const auto opcodes = get_opcodes();
+    for (size_t i = 0; i < opcodes.size(); ++i) {
+        const auto& op = opcodes[i];
+        json += std::format("{}\n    {{\"opcode\": \"{}{:02x}\", \"instruction\": \"{}\", "
+                            "\"cycles\": {}, \"hits\": {}, \"percent\": {:.3f}}}",
+                            i == 0 ? "" : ",", op.m_prefixed ? "cb" : "", op.m_opcode,
+                            format_mnemonic(op.m_opcode, op.m_prefixed), op.m_cycles, op.m_hits,
+                            percent_of(op.m_cycles, m_totalCycles));
+    }
+    json += "\n  ]\n}\n";
+    return json;
+}
+
+std::string Profiler::to_csv(size_t maxHotSpots) const {
+    // one table for both, kind tells the rows apart
+    auto csv = std::string("kind,bank,pc,opcode,instruction,cycles,hits,percent\n");
+    for (const auto& spot : get_hot_spots(maxHotSpots)) {
+        csv += std::format("pc,{},{:04x},{}{:02x},{},{},{},{:.3f}\n",
+                           spot.m_bank == NO_BANK ? "" : std::to_string(spot.m_bank), spot.m_pc,
+                           spot.m_prefixed ? "cb" : "", spot.m_opcode,
+                           format_mnemonic(spot.m_opcode, spot.m_prefixed), spot.m_cycles,
+                           spot.m_hits, percent_of(spot.m_cycles, m_totalCycles));
+    }
+    for (const auto& op : get_opcodes()) {
+        csv += std::format("opcode,,,{}{:02x},{},{},{},{:.3f}\n", op.m_prefixed ? "cb" : "",
+                           op.m_opcode, format_mnemonic(op.m_opcode, op.m_prefixed), op.m_cycles,
+                           op.m_hits, percent_of(op.m_cycles, m_totalCycles));
+    }
+    return csv;
+}
+
+bool Profiler::write_report(const fs::path& path, size_t maxHotSpots) const {
+    auto file = std::ofstream(path);
+    if (!file) {
+        log_error("Failed to open profile report: {}", path.string());
+        return false;
+    }
+    file << (path.extension() == ".json" ? to_json(maxHotSpots) : to_csv(maxHotSpots));
+    return bool(file);
+}
+
+} // namespace ez
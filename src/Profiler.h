@@ -0,0 +1,77 @@
+#pragma once
+#include "Base.h"
+
+namespace ez {
+
+// Guest code profiler: cycles and hit counts per instruction address and per opcode.
+//
+// Addresses are counted per ROM bank, so the same PC in two banks is two entries. Everything lives
+// in flat arrays sized when the profiler is made, recording an instruction is a few adds. The
+// emulator only records while one is attached (see Emulator::start_profiling) and runs its
+// DebugPolicy CPU while it is, the FastPolicy one never checks
+class Profiler {
+  public:
+    static constexpr int NO_BANK = -1; // WRAM, HRAM, the bootrom...
+    static constexpr int OPCODE_SLOTS = 512; // unprefixed then CB prefixed
+
+    struct Location {
+        int m_bank = NO_BANK;
+        uint16_t m_pc = 0;
+        uint8_t m_opcode = 0; // the last one executed there
+        bool m_prefixed = false;
+        int64_t m_cycles = 0;
+        int64_t m_hits = 0;
+    };
+
+    struct OpCode {
+        uint8_t m_opcode = 0;
+        bool m_prefixed = false;
+        int64_t m_cycles = 0;
+        int64_t m_hits = 0;
+    };
+
+    // romBytes is the size of the whole cart ROM, every bank gets its own entries
+    explicit Profiler(size_t romBytes);
+    EZ_DECLARE_COPY_MOVE(Profiler, delete, delete);
+
+    // romOffset is where the instruction is in the cart ROM, nullopt if it isn't in ROM
+    void record(std::optional<size_t> romOffset, uint16_t pc, uint8_t opcode, bool prefixed,
+                int cycles) {
+        const auto slot = romOffset ? *romOffset : m_romBytes + pc;
+        const auto opSlot = size_t(opcode) + (prefixed ? 256 : 0);
+        m_cycles[slot] += uint64_t(cycles);
+        ++m_hits[slot];
+        m_opcodes[slot] = uint16_t(opSlot);
+        m_opcodeCycles[opSlot] += uint64_t(cycles);
+        ++m_opcodeHits[opSlot];
+        m_totalCycles += cycles;
+        ++m_totalHits;
+    }
+
+    void reset();
+
+    int64_t get_total_cycles() const { return m_totalCycles; }
+    int64_t get_total_hits() const { return m_totalHits; }
+    // the maxCount addresses with the most cycles, most first
+    std::vector<Location> get_hot_spots(size_t maxCount) const;
+    // every opcode that ran, most cycles first
+    std::vector<OpCode> get_opcodes() const;
+
+    // JSON if the extension is .json, otherwise CSV
+    bool write_report(const fs::path& path, size_t maxHotSpots) const;
+    std::string to_json(size_t maxHotSpots) const;
+    std::string to_csv(size_t maxHotSpots) const;
+
+  private:
+    size_t m_romBytes = 0;
+    // one entry per ROM byte, then one per address for code outside the ROM
+    std::vector<uint64_t> m_cycles;
+    std::vector<uint64_t> m_hits;
+    std::vector<uint16_t> m_opcodes; // opcode slots
+    std::array<uint64_t, OPCODE_SLOTS> m_opcodeCycles{};
+    std::array<uint64_t, OPCODE_SLOTS> m_opcodeHits{};
+    int64_t m_totalCycles = 0;
+    int64_t m_totalHits = 0;
+};
+
+} // namespace ez
@@ -0,0 +1,176 @@
+#include "Recompiler.h"
+#include "BlockCache.h"
+#include "Cart.h"
+#include "OpCodes.h"
+#include <algorithm>
+
+namespace ez {
+namespace {
+
+constexpr auto BANK_SIZE = RecoveredBlock::ROM_BANK_SIZE;
+
+// entry point after the bootrom, RST vectors, then the VBlank, STAT, timer, serial and joypad ISRs
+constexpr auto ENTRY_POINTS = std::array<uint16_t, 14>{
+    0x0100, 0x0000, 0x0008, 0x0010, 0x0018, 0x0020, 0x0028,
+    0x0030, 0x0038, 0x0040, 0x0048, 0x0050, 0x0058, 0x0060,
+};
+
+uint32_t read_pc_data_at(std::span<const uint8_t> rom, size_t offset) {
+    uint32_t pcData = 0;
+    memcpy(&pcData, rom.data() + offset, sizeof(pcData));
+    return pcData;
+}
+
+// where a jump or call goes if that can be known without running it
+std::optional<uint16_t> get_static_target(uint16_t pc, uint32_t pcData) {
+    const auto op = uint8_t(pcData & 0xFF);
+    const auto& details = OPCODE_DETAILS[op];
+    const auto mnemonic = std::string_view{details.m_mnemonic};
+    const auto nextPC = uint16_t(pc + OPCODE_TIMINGS[op].m_size);
+    if (mnemonic == "JR") {
+        return uint16_t(nextPC + int8_t(pcData >> 8));
+    }
+    if ((mnemonic == "JP" || mnemonic == "CALL") &&
+        (details.m_operandName1 == "a16"sv || details.m_operandName2 == "a16"sv)) {
+        return uint16_t(pcData >> 8);
+    }
+    if (mnemonic == "RST") {
+        return uint16_t(op & 0x38);
+    }
+    return std::nullopt;
+}
+
+} // namespace
+
+uint64_t hash_rom(std::span<const uint8_t> rom) {
+    // FNV-1a
+    auto hash = 0xCBF29CE484222325ull;
+    for (const auto byte : rom) {
+        hash = (hash ^ byte) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+std::vector<RecoveredBlock> recover_blocks(std::span<const uint8_t> rom) {
+    const auto numBanks = int((rom.size() + BANK_SIZE - 1) / BANK_SIZE);
+
+    auto pending = std::vector<std::pair<int, uint16_t>>{}; // bank, address
+    const auto addTarget = [&](int fromBank, uint16_t addr) {
+        if (addr < BANK_SIZE) {
+            pending.emplace_back(0, addr);
+        } else if (addr < Cart::ROM_RANGE.m_max) {
+            // from bank 0 the switchable bank could be any of them
+            const auto firstBank = fromBank == 0 ? 1 : fromBank;
+            const auto lastBank = fromBank == 0 ? numBanks - 1 : fromBank;
+            for (int bank = firstBank; bank <= lastBank; ++bank) {
+                pending.emplace_back(bank, addr);
+            }
+        } // anything else is RAM, which the block cache handles
+    };
+    for (const auto entry : ENTRY_POINTS) {
+        addTarget(0, entry);
+    }
+
+    auto blocks = std::vector<RecoveredBlock>{};
+    auto visited = std::vector<bool>(rom.size());
+    while (!pending.empty()) {
+        auto block = RecoveredBlock{};
+        std::tie(block.m_bank, block.m_addr) = pending.back();
+        pending.pop_back();
+        auto offset = size_t(block.get_rom_offset());
+        if (offset >= rom.size() || visited[offset]) {
+            continue;
+        }
+        visited[offset] = true;
+
+        // pcData is read 4 bytes at a time and mustn't run into the next bank, which at runtime
+        // isn't necessarily the next one in the file
+        const auto bankEnd = std::min(size_t(block.m_bank + 1) * BANK_SIZE, rom.size());
+        auto pc = block.m_addr;
+        while (offset + sizeof(uint32_t) <= bankEnd) {
+            const auto pcData = read_pc_data_at(rom, offset);
+            const auto op = uint8_t(pcData & 0xFF);
+            if (std::string_view{OPCODE_DETAILS[op].m_mnemonic}.starts_with("ILLEGAL")) {
+                break;
+            }
+            if (OpCode(op) == OpCode::PREFIX) {
+                if (offset + 1 + sizeof(uint32_t) > bankEnd) {
+                    break;
+                }
+                const auto cbData = read_pc_data_at(rom, offset + 1);
+                block.m_instrs.push_back({op, false, 1, pcData});
+                block.m_instrs.push_back({uint8_t(cbData & 0xFF), true, 1, cbData});
+                offset += 2;
+                pc += 2;
+                continue;
+            }
+
+            const auto size = OPCODE_TIMINGS[op].m_size;
+            block.m_instrs.push_back({op, false, size, pcData});
+            if (const auto target = get_static_target(pc, pcData)) {
+                addTarget(block.m_bank, *target);
+            }
+            const auto mnemonic = std::string_view{OPCODE_DETAILS[op].m_mnemonic};
+            if (mnemonic == "CALL" || mnemonic == "RST") {
+                addTarget(block.m_bank, uint16_t(pc + size)); // where it returns to
+            }
+            offset += size;
+            pc += size;
+            if (Block::ends_after(op)) {
+                break;
+            }
+        }
+        if (!block.m_instrs.empty()) {
+            blocks.push_back(std::move(block));
+        }
+    }
+
+    std::ranges::sort(blocks, {}, &RecoveredBlock::get_rom_offset);
+    return blocks;
+}
+
+std::string emit_compiled_rom(std::span<const uint8_t> rom, std::span<const RecoveredBlock> blocks,
+                              std::string_view romName) {
+    auto out = std::string{};
+    out += std::format("// Generated by ezgb_recompile from {}, do not edit\n", romName);
+    out += "#include \"Emulator.h\"\n\n";
+    out += R"(// runs one instruction, leaves the block unless it fell through to the next
+#define STEP(OP, PREFIXED, PC_DATA, SIZE)                                                          \
+    if (const auto step = emu.run_compiled_instr<OP, PREFIXED>(PC_DATA, SIZE, untilCycle);         \
+        step != CompiledStep::NEXT) {                                                              \
+        return step;                                                                               \
+    }
+
+)";
+    out += "namespace {\n\nusing ez::CompiledStep;\nusing ez::Emulator;\n\n";
+
+    const auto fnName = [](const RecoveredBlock& block) {
+        return std::format("block_{:02x}_{:04x}", block.m_bank, block.m_addr);
+    };
+    for (const auto& block : blocks) {
+        out += std::format("CompiledStep {}(Emulator& emu, int64_t untilCycle) {{\n",
+                           fnName(block));
+        for (const auto& instr : block.m_instrs) {
+            const auto& details =
+                instr.m_prefixed ? OPCODE_DETAILS_PREFIXED[instr.m_op] : OPCODE_DETAILS[instr.m_op];
+            auto line = std::format("    STEP(0x{:02X}, {}, 0x{:08X}, {}) // {} {} {}", instr.m_op,
+                                    instr.m_prefixed, instr.m_pcData, instr.m_size,
+                                    details.m_mnemonic, details.m_operandName1,
+                                    details.m_operandName2);
+            line.erase(line.find_last_not_of(' ') + 1);
+            out += line + '\n';
+        }
+        out += "    return CompiledStep::NEXT;\n}\n\n";
+    }
+
+    out += "const ez::CompiledBlock BLOCKS[] = {\n";
+    for (const auto& block : blocks) {
+        out += std::format("    {{0x{:06X}, &{}}},\n", block.get_rom_offset(), fnName(block));
+    }
+    out += "};\n\n} // namespace\n\n";
+    out += std::format("extern const ez::CompiledRom RECOMPILED_ROM = {{0x{:016X}ull, BLOCKS}};\n",
+                       hash_rom(rom));
+    return out;
+}
+
+} // namespace ez
@@ -0,0 +1,67 @@
+#pragma once
+#include "Base.h"
+
+namespace ez {
+
+class Emulator;
+
+// Ahead of time recompilation of a fixed ROM. ezgb_recompile disassembles every bank and writes a
+// C++ file with one function per recovered block, which is built into a ROM-specific runner (see
+// EZ_RECOMPILED_ROM in CMakeLists.txt). The functions call the same handlers as CpuDispatch::CACHED
+// with the opcode and operands baked in, so the cycle accounting is identical. PCs that aren't the
+// start of a recovered block, e.g. JP HL or RET to somewhere the disassembly didn't find, and code
+// in RAM fall back to the block cache and the interpreter
+
+// how a compiled instruction left the CPU
+enum class CompiledStep : uint8_t {
+    NEXT,   // fell through, the next instruction can run straight away
+    JUMPED, // went somewhere else, which can run straight away
+    STOP,   // run_for has to fire events, catch the PPU up or check for interrupts first
+};
+
+using CompiledBlockFn = CompiledStep (*)(Emulator& emu, int64_t untilCycle);
+
+struct CompiledBlock {
+    uint32_t m_romOffset = 0; // of the first instruction
+    CompiledBlockFn m_fn = nullptr;
+};
+
+// everything a generated file exports
+struct CompiledRom {
+    uint64_t m_romHash = 0; // blocks are only used for the exact ROM they were built from
+    std::span<const CompiledBlock> m_blocks;
+};
+
+// a block found by recover_blocks, instructions run in order
+struct RecoveredBlock {
+    struct Instr {
+        uint8_t m_op = 0;
+        bool m_prefixed = false;
+        uint8_t m_size = 0;    // bytes to the next instruction
+        uint32_t m_pcData = 0; // as read_pc_data returns it
+    };
+
+    int m_bank = 0;
+    uint16_t m_addr = 0; // CPU address, 0x4000-0x7FFF for banks other than 0
+    std::vector<Instr> m_instrs;
+
+    static constexpr int ROM_BANK_SIZE = 0x4000;
+
+    uint32_t get_rom_offset() const {
+        return uint32_t(m_bank * ROM_BANK_SIZE + m_addr % ROM_BANK_SIZE);
+    }
+};
+
+uint64_t hash_rom(std::span<const uint8_t> rom);
+
+// Recursive descent from the entry point, RST and interrupt vectors through every jump, call and
+// return address it can resolve statically. Targets in the switchable bank reached from bank 0 are
+// followed in every bank since the bank can't be known. Blocks end like BlockCache ones do, minus
+// the page and length limits, or before an illegal opcode or an instruction crossing the bank end
+std::vector<RecoveredBlock> recover_blocks(std::span<const uint8_t> rom);
+
+// the C++ translation unit ezgb_recompile writes, defines RECOMPILED_ROM
+std::string emit_compiled_rom(std::span<const uint8_t> rom, std::span<const RecoveredBlock> blocks,
+                              std::string_view romName);
+
+} // namespace ez
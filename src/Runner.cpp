@@ -4,57 +4,75 @@ namespace ez {
 
 RunResult ez::Runner::tick(const InputState& input, audio::SinkFunc putSamples) {
     auto ret = RunResult::CONTINUE;
+    auto& emu = *m_state.m_emu;
+    emu.set_input(input);
+    update_debug_hooks();
     if (m_state.m_isPaused) {
         if (m_state.m_stepToNextInstr) {
-            while (true) {
-                tick_emu_once(input, putSamples);
-                if (m_state.m_emu->executed_instr_this_cycle()) {
-                    break;
-                }
-            }
+            emu.step();
+            check_breakpoints();
             m_state.m_stepToNextInstr = false;
-        }
-        else if(m_state.m_stepOneCycle){
-            tick_emu_once(input, putSamples);
+        } else if (m_state.m_stepOneCycle) {
+            emu.run_for(1);
+            check_breakpoints();
             m_state.m_stepOneCycle = false;
         }
         ret = RunResult::DRAW;
-    } else {
-        tick_emu_once(input, putSamples);
-        ++m_ticksSinceLastDraw;
-        if (m_ticksSinceLastDraw == TICKS_PER_DRAW) {
+    } else if (m_state.m_debugSettings.any_enabled()) {
+        // breakpoints only change state on CPU steps, so there's no need to check every cycle
+        m_ticksSinceLastDraw += int(emu.step());
+        check_breakpoints();
+        if (m_ticksSinceLastDraw >= TICKS_PER_DRAW) {
             ret = RunResult::DRAW;
         }
+    } else {
+        emu.run_for(TICKS_PER_DRAW - m_ticksSinceLastDraw);
+        ret = RunResult::DRAW;
     }
+    putSamples(emu.get_audio_samples());
+    emu.clear_audio_buffer();
+
     if (ret == RunResult::DRAW) {
         m_ticksSinceLastDraw = 0;
     }
     return ret;
 }
 
-void Runner::tick_emu_once(const InputState& input, audio::SinkFunc putSamples) {
+void Runner::update_debug_hooks() {
+    // write breakpoints need the debug flavour's write tracking. Once the last breakpoint is
+    // cleared the fast CPU takes over again, unless the hooks were switched on by hand
+    auto& emu = *m_state.m_emu;
+    const auto wanted = m_state.m_debugSettings.any_enabled();
+    if (wanted && !emu.get_debug_hooks()) {
+        emu.set_debug_hooks(true);
+        m_breakpointHooks = true;
+    } else if (!wanted && m_breakpointHooks) {
+        emu.set_debug_hooks(false);
+        m_breakpointHooks = false;
+    }
+}
+
+void Runner::check_breakpoints() {
+    auto& emu = *m_state.m_emu;
     bool shouldBreak = false;
-    m_state.m_emu->tick(input);
-    shouldBreak |= m_state.m_emu->want_breakpoint();
-    shouldBreak |= m_state.m_emu->get_pc() == m_state.m_debugSettings.m_breakOnPC;
-    const auto currentOp = m_state.m_emu->get_current_opcode();
-    shouldBreak |=
-        currentOp.m_addr == (currentOp.m_prefixed ? m_state.m_debugSettings.m_breakOnOpCodePrefixed
-                                                  : m_state.m_debugSettings.m_breakOnOpCode);
-    if (m_state.m_emu->get_last_written_addr() == m_state.m_debugSettings.m_breakOnWriteAddr) {
+    shouldBreak |= emu.want_breakpoint();
+    shouldBreak |= emu.get_pc() == m_state.m_debugSettings.m_breakOnPC;
+    const auto currentOp = emu.get_current_op_byte();
+    shouldBreak |= currentOp == (emu.is_current_op_prefixed()
+                                     ? m_state.m_debugSettings.m_breakOnOpCodePrefixed
+                                     : m_state.m_debugSettings.m_breakOnOpCode);
+    if (emu.get_last_written_addr() == m_state.m_debugSettings.m_breakOnWriteAddr) {
         shouldBreak = true;
-        if (m_state.m_emu->executed_instr_this_cycle()) {
-            m_state.m_emu->get_last_written_addr() = -2;
+        if (emu.executed_instr_this_cycle()) {
+            emu.get_last_written_addr() = -2;
         }
     }
 
-    if (shouldBreak && m_state.m_emu->executed_instr_this_cycle()) {
+    if (shouldBreak && emu.executed_instr_this_cycle()) {
         log_info("Debug Break!");
-        m_state.m_emu->clear_want_breakpoint();
+        emu.clear_want_breakpoint();
         m_state.m_isPaused = true;
     }
-    putSamples(m_state.m_emu->get_audio_samples());
-    m_state.m_emu->clear_audio_buffer();
 }
 
 } // namespace ez
\ No newline at end of file
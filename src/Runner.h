@@ -18,9 +18,11 @@ class Runner {
     RunResult tick(const InputState& input, audio::SinkFunc putSamples);
 
   private:
-    void tick_emu_once(const InputState& input, audio::SinkFunc putSamples);
+    void update_debug_hooks(); // on while any breakpoint is set
+    void check_breakpoints();
 
     int m_ticksSinceLastDraw = 0;
+    bool m_breakpointHooks = false; // the debug hooks are only on for the breakpoints
     static constexpr auto TICKS_PER_DRAW = 70'224; // dots per v-sync;
     AppState& m_state;
 };
@@ -0,0 +1,52 @@
+#include "Scheduler.h"
+#include <algorithm>
+
+namespace ez {
+
+namespace {
+// std heaps are max-heaps, so order by "fires later" to get the earliest event on top
+bool fires_later(const Event& lhs, const Event& rhs) {
+    return lhs.m_cycle != rhs.m_cycle ? lhs.m_cycle > rhs.m_cycle : lhs.m_type > rhs.m_type;
+}
+} // namespace
+
+void Scheduler::schedule(EventType type, int64_t cycle) {
+    ez_assert(cycle != NEVER);
+    if (m_scheduledCycle[+type] == cycle) {
+        return;
+    }
+    m_scheduledCycle[+type] = cycle;
+    m_heap.push_back({cycle, type});
+    std::push_heap(m_heap.begin(), m_heap.end(), fires_later);
+}
+
+void Scheduler::clear() {
+    m_heap.clear();
+    m_scheduledCycle = make_unscheduled();
+}
+
+void Scheduler::drop_stale() {
+    while (!m_heap.empty() && m_heap.front().m_cycle != m_scheduledCycle[+m_heap.front().m_type]) {
+        std::pop_heap(m_heap.begin(), m_heap.end(), fires_later);
+        m_heap.pop_back();
+    }
+}
+
+int64_t Scheduler::next_cycle() {
+    drop_stale();
+    return m_heap.empty() ? NEVER : m_heap.front().m_cycle;
+}
+
+std::optional<Event> Scheduler::pop_due(int64_t cycle) {
+    drop_stale();
+    if (m_heap.empty() || m_heap.front().m_cycle > cycle) {
+        return std::nullopt;
+    }
+    const auto event = m_heap.front();
+    std::pop_heap(m_heap.begin(), m_heap.end(), fires_later);
+    m_heap.pop_back();
+    m_scheduledCycle[+event.m_type] = NEVER;
+    return event;
+}
+
+} // namespace ez
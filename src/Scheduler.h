@@ -0,0 +1,55 @@
+#pragma once
+#include "Base.h"
+
+namespace ez {
+
+// Something that happens at a known T-cycle. Events landing on the same cycle fire in enum order,
+// which matches the order the per T-cycle tick used to process them in
+enum class EventType : uint8_t {
+    IME_ENABLE,     // EI/RETI delay elapsed
+    TIMA_RELOAD,    // one m-cycle after TIMA overflowed, reload from TMA and raise the timer IRQ
+    OAM_DMA_END,    // OAM DMA transfer finished
+    TIMA_OVERFLOW,  // the TIMA increment that wraps it to 0, see Emulator::get_tima
+    NUM_EVENTS
+};
+
+struct Event {
+    int64_t m_cycle = 0;
+    EventType m_type = EventType::IME_ENABLE;
+};
+
+// Min-heap of events keyed by absolute T-cycle. Each type is scheduled at most once, rescheduling
+// or cancelling leaves a stale heap entry that is dropped when it reaches the top
+class Scheduler {
+  public:
+    friend class Tester;
+
+    static constexpr int64_t NEVER = std::numeric_limits<int64_t>::max();
+
+    void schedule(EventType type, int64_t cycle);
+    void cancel(EventType type) { m_scheduledCycle[+type] = NEVER; }
+    void clear();
+
+    bool is_scheduled(EventType type) const { return m_scheduledCycle[+type] != NEVER; }
+    int64_t get_cycle(EventType type) const { return m_scheduledCycle[+type]; }
+
+    // cycle of the earliest live event, NEVER if there is none
+    int64_t next_cycle();
+
+    // removes and returns the earliest live event if it fires at or before cycle
+    std::optional<Event> pop_due(int64_t cycle);
+
+  private:
+    void drop_stale();
+
+    std::vector<Event> m_heap;
+    std::array<int64_t, size_t(EventType::NUM_EVENTS)> m_scheduledCycle = make_unscheduled();
+
+    static constexpr std::array<int64_t, size_t(EventType::NUM_EVENTS)> make_unscheduled() {
+        auto cycles = std::array<int64_t, size_t(EventType::NUM_EVENTS)>{};
+        cycles.fill(NEVER);
+        return cycles;
+    }
+};
+
+} // namespace ez
@@ -1,6 +1,7 @@
 #include "Test.h"
 #include "Base.h"
 #include "MiscOps.h"
+#include "TileDecode.h"
 
 namespace ez {
 
@@ -40,6 +41,629 @@ bool Tester::test_timer() {
         }
     }
 
+    // TIMA is worked out from the cycle rather than ticked, overflowing and reloading an M-cycle
+    // later has to land on the same cycles
+    auto cart = make_cart();
+    auto settings = EmuSettings{};
+    settings.m_skipBootROM = true;
+    auto emu = Emulator(cart, settings);
+    emu.write_addr(+IOAddr::DIV, 0); // the system clock restarts from the next cycle
+    emu.write_addr(+IOAddr::TMA, 0xFE);
+    emu.write_addr(+IOAddr::TIMA, 0xFC);
+    emu.write_addr(+IOAddr::TAC, 0b101); // every 16 cycles
+    const auto expected = std::array<std::pair<int64_t, uint8_t>, 7>{{
+        {16, 0xFC}, {17, 0xFD}, {64, 0xFF}, {65, 0x00}, {69, 0x00}, {70, 0xFE}, {97, 0x00}}};
+    for (const auto& [cycle, tima] : expected) {
+        emu.run_for(cycle - emu.get_cycle_counter());
+        ez_assert(emu.m_ioReg->m_tima == tima);
+        ez_assert(emu.m_ioReg->m_if.timer == (cycle >= 70));
+    }
+    ez_assert(emu.get_tima_overflow_cycle() == 96 + T_CYCLES_PER_M_CYCLE + 1);
+    emu.run_for(256 - 97);
+    ez_assert(emu.m_ioReg->m_timerDivider == 0);
+    emu.run_for(1);
+    ez_assert(emu.m_ioReg->m_timerDivider == 1);
+
+    // STOP restarts the system clock like a DIV write
+    emu.run_for(0x400);
+    ez_assert(emu.m_ioReg->m_timerDivider == 5);
+    emu.write_addr(0xC000, 0x10); // STOP
+    emu.write_addr(0xC001, 0x00);
+    emu.m_reg.pc = 0xC000;
+    emu.run_for(T_CYCLES_PER_M_CYCLE);
+    ez_assert(emu.m_stopMode);
+    ez_assert(emu.m_ioReg->m_timerDivider == 0);
+    ez_assert(emu.get_sysclk(emu.get_cycle_counter()) < T_CYCLES_PER_M_CYCLE);
+
+    return true;
+}
+
+bool Tester::test_oam_dma() {
+    auto cart = make_cart();
+    auto settings = EmuSettings{};
+    settings.m_skipBootROM = true;
+    auto emu = Emulator(cart, settings);
+    emu.m_haltMode = true; // ROM reads 0xFF while the DMA runs, keep the CPU off the bus
+    for (auto i = 0; i < Emulator::OAM_DMA_BYTES; ++i) {
+        emu.write_addr(uint16_t(0xC100 + i), uint8_t(i ^ 0x5A));
+    }
+    emu.protect_ram_page(1, true); // as if 0xC100 held cached code
+
+    const auto start = emu.m_cpuCycle + T_CYCLES_PER_M_CYCLE;
+    emu.write_addr(+IOAddr::DMA, 0xC1);
+    ez_assert(emu.m_oamDmaActive);
+    ez_assert(emu.read_addr(+IOAddr::DMA) == 0xC1);
+
+    // only IO and HRAM are reachable, the rest reads 0xFF and ignores writes
+    ez_assert(emu.read_addr(0xC100) == 0xFF);
+    ez_assert(emu.read_addr(0x0000) == 0xFF);
+    ez_assert(emu.read_addr(PPU::OAM_ADDR_RANGE.m_min) == 0xFF);
+    emu.write_addr(0xC105, 0x00);
+    emu.write_addr(0xFF80, 0x12);
+    ez_assert(emu.read_addr(0xFF80) == 0x12);
+
+    // a byte per M-cycle
+    emu.run_for(start + 10 * T_CYCLES_PER_M_CYCLE + 1 - emu.get_cycle_counter());
+    ez_assert(emu.m_ppu.m_oam[10] == (10 ^ 0x5A));
+    ez_assert(emu.m_ppu.m_oam[11] == 0);
+    emu.run_for(start + Emulator::OAM_DMA_BYTES * T_CYCLES_PER_M_CYCLE - emu.get_cycle_counter());
+    ez_assert(emu.m_oamDmaActive);
+    emu.run_for(1);
+    ez_assert(!emu.m_oamDmaActive);
+    for (auto i = 0; i < Emulator::OAM_DMA_BYTES; ++i) {
+        ez_assert(emu.m_ppu.m_oam[i] == uint8_t(i ^ 0x5A));
+    }
+
+    // the memory map comes back, still protecting the code page
+    ez_assert(emu.read_addr(0xC105) == (5 ^ 0x5A));
+    ez_assert(emu.m_readPages[0xC1] && !emu.m_writePages[0xC1]);
+
+    return true;
+}
+
+bool Tester::test_scheduler() {
+    auto scheduler = Scheduler{};
+    ez_assert(scheduler.next_cycle() == Scheduler::NEVER);
+
+    scheduler.schedule(EventType::TIMA_OVERFLOW, 100);
+    scheduler.schedule(EventType::OAM_DMA_END, 50);
+    scheduler.schedule(EventType::IME_ENABLE, 100);
+    ez_assert(scheduler.next_cycle() == 50);
+    ez_assert(!scheduler.pop_due(49));
+
+    auto event = scheduler.pop_due(100);
+    ez_assert(event && event->m_type == EventType::OAM_DMA_END && event->m_cycle == 50);
+    ez_assert(!scheduler.is_scheduled(EventType::OAM_DMA_END));
+
+    // same cycle fires in enum order
+    event = scheduler.pop_due(100);
+    ez_assert(event && event->m_type == EventType::IME_ENABLE);
+    event = scheduler.pop_due(100);
+    ez_assert(event && event->m_type == EventType::TIMA_OVERFLOW);
+    ez_assert(!scheduler.pop_due(100));
+
+    // rescheduling and cancelling leave stale entries behind that must never fire
+    scheduler.schedule(EventType::TIMA_RELOAD, 10);
+    scheduler.schedule(EventType::TIMA_RELOAD, 20);
+    scheduler.schedule(EventType::IME_ENABLE, 5);
+    scheduler.cancel(EventType::IME_ENABLE);
+    ez_assert(scheduler.next_cycle() == 20);
+    event = scheduler.pop_due(Scheduler::NEVER - 1);
+    ez_assert(event && event->m_type == EventType::TIMA_RELOAD && event->m_cycle == 20);
+    ez_assert(scheduler.next_cycle() == Scheduler::NEVER);
+
+    return true;
+}
+
+Emulator Tester::check_run_for_matches_tick(Cart& cart) {
+    auto settings = EmuSettings{};
+    settings.m_skipBootROM = true;
+    auto perCycle = Emulator(cart, settings);
+    auto chunked = Emulator(cart, settings);
+    const auto input = InputState{};
+
+    // stepping a cycle at a time and in uneven chunks has to land on the same state
+    const auto chunks = std::array<int64_t, 6>{1, 3, 17, 456, 4099, 70224};
+    for (int i = 0; i < 64; ++i) {
+        const auto chunk = chunks[i % chunks.size()];
+        for (int64_t cycle = 0; cycle < chunk; ++cycle) {
+            perCycle.tick(input);
+        }
+        chunked.set_input(input);
+        chunked.run_for(chunk);
+
+        ez_assert(perCycle.get_cycle_counter() == chunked.get_cycle_counter());
+        ez_assert(memcmp(&perCycle.m_reg, &chunked.m_reg, sizeof(Reg)) == 0);
+        for (auto addr : {IOAddr::DIV, IOAddr::TIMA, IOAddr::IF, IOAddr::LY, IOAddr::STAT}) {
+            ez_assert(perCycle.read_addr(+addr) == chunked.read_addr(+addr));
+        }
+        const auto expectedSamples = perCycle.get_audio_samples();
+        const auto samples = chunked.get_audio_samples();
+        ez_assert(expectedSamples.size() == samples.size());
+        ez_assert(memcmp(expectedSamples.data(), samples.data(), samples.size_bytes()) == 0);
+        perCycle.clear_audio_buffer();
+        chunked.clear_audio_buffer();
+    }
+    return chunked;
+}
+
+bool Tester::test_run_for() {
+    // a timer + vblank interrupt driven loop that halts, resets DIV and enables interrupts
+    auto romData = std::vector<uint8_t>(32 * 1024ull);
+    const auto vblankISR = std::array<uint8_t, 1>{0xD9};     // RETI
+    const auto timerISR = std::array<uint8_t, 2>{0x0C, 0xD9}; // INC C, RETI
+    const auto program = std::array<uint8_t, 20>{
+        0x3E, 0x05, 0xE0, 0x07, // LD A, 0x05 ; LDH (TAC), A
+        0x3E, 0x05, 0xE0, 0xFF, // LD A, 0x05 ; LDH (IE), A
+        0xFB,                   // EI
+        0x76,                   // loop: HALT
+        0x04,                   // INC B
+        0x78, 0xE6, 0x3F,       // LD A, B ; AND 0x3F
+        0x20, 0x02,             // JR NZ, +2
+        0xE0, 0x04,             // LDH (DIV), A
+        0x18, 0xF5,             // JR loop
+    };
+    std::copy(vblankISR.begin(), vblankISR.end(), romData.begin() + 0x40);
+    std::copy(timerISR.begin(), timerISR.end(), romData.begin() + 0x50);
+    std::copy(program.begin(), program.end(), romData.begin() + 0x100);
+    auto cart = Cart(romData);
+    const auto chunked = check_run_for_matches_tick(cart);
+
+    // the loop has to have actually been interrupted by both sources
+    ez_assert(chunked.m_reg.c != 0x13);
+    ez_assert(chunked.m_reg.b != 0x00);
+
+    return true;
+}
+
+bool Tester::test_low_pass_filter() {
+    // a decaying average has to reach zero instead of sitting on a denormal, math on those is
+    // dozens of times slower and the APU filters every sample
+    auto filter = LowPassFilter{64};
+    for (int i = 0; i < 64; ++i) {
+        filter.process(1.0f);
+    }
+    auto average = 1.0f;
+    for (int i = 0; i < 100'000 && average != 0.0f; ++i) {
+        average = filter.process(0.0f);
+        ez_assert(std::fpclassify(average) != FP_SUBNORMAL);
+    }
+    ez_assert(average == 0.0f);
+
+    return true;
+}
+
+bool Tester::test_halt_fast_forward() {
+    // the vblank prediction a halted CPU jumps to has to match ticking the PPU there
+    auto emu = make_emulator();
+    emu.m_ioReg->m_lcd.m_control.m_ppuEnable = true;
+    auto& ppu = emu.m_ppu;
+    for (int sample = 0; sample < 50; ++sample) {
+        const auto predicted = ppu.get_dots_until_vblank();
+        const auto startFrame = ppu.get_frame_count();
+        auto dots = 0;
+        while (ppu.get_frame_count() == startFrame) {
+            ppu.tick();
+            ++dots;
+        }
+        ez_assert(predicted == dots);
+        // land somewhere else in the frame for the next sample
+        for (int i = 0; i < sample * 997 % PPU::DOTS_PER_FRAME; ++i) {
+            ppu.tick();
+        }
+    }
+
+    // a STAT (LY == LYC) interrupt driven loop that halts between interrupts
+    auto romData = std::vector<uint8_t>(32 * 1024ull);
+    const auto statISR = std::array<uint8_t, 2>{0x0C, 0xD9}; // INC C, RETI
+    const auto program = std::array<uint8_t, 20>{
+        0x3E, 0x40, 0xE0, 0x41, // LD A, 0x40 ; LDH (STAT), A
+        0x3E, 0x50, 0xE0, 0x45, // LD A, 0x50 ; LDH (LYC), A
+        0x3E, 0x02, 0xE0, 0xFF, // LD A, 0x02 ; LDH (IE), A
+        0xFB,                   // EI
+        0x76,                   // loop: HALT
+        0x04,                   // INC B
+        0x78, 0xE0, 0x45,       // LD A, B ; LDH (LYC), A
+        0x18, 0xF9,             // JR loop
+    };
+    std::copy(statISR.begin(), statISR.end(), romData.begin() + 0x48);
+    std::copy(program.begin(), program.end(), romData.begin() + 0x100);
+    auto cart = Cart(romData);
+    check_run_for_matches_tick(cart);
+
+    // and the HALT itself is one CPU step straight to the cycle the interrupt can wake it on,
+    // not one per M-cycle
+    auto settings = EmuSettings{};
+    settings.m_skipBootROM = true;
+    auto halted = Emulator(cart, settings);
+    while (!halted.m_haltMode) {
+        halted.run_for(T_CYCLES_PER_M_CYCLE);
+    }
+    const auto haltCycle = halted.m_cpuCycle;
+    const auto wakeCycle = halted.get_next_interrupt_cycle();
+    ez_assert(wakeCycle - haltCycle > 10 * T_CYCLES_PER_M_CYCLE);
+    const auto instructions = halted.get_instruction_counter();
+    halted.step_cpu(haltCycle + PPU::DOTS_PER_FRAME);
+    ez_assert(halted.m_cpuCycle >= wakeCycle);
+    ez_assert(halted.m_cpuCycle - wakeCycle < T_CYCLES_PER_M_CYCLE);
+    ez_assert(halted.m_haltMode && halted.get_instruction_counter() == instructions);
+
+    return true;
+}
+
+bool Tester::test_idle_loops() {
+    // waits for LY == 0x90 with a polling loop, then for mode 0 with BIT on STAT, then for DIV to
+    // change, then spins a counter loop that must not be skipped
+    auto romData = std::vector<uint8_t>(32 * 1024ull);
+    const auto program = std::array<uint8_t, 23>{
+        0xF0, 0x44, 0xFE, 0x90, // loop: LDH A, (LY) ; CP 0x90
+        0x20, 0xFA,             // JR NZ, loop
+        0xF0, 0x41, 0xE6, 0x03, // LDH A, (STAT) ; AND 0x03
+        0x20, 0xFA,             // JR NZ, -6
+        0xF0, 0x04, 0x47,       // LDH A, (DIV) ; LD B, A
+        0xF0, 0x04, 0xB8,       // LDH A, (DIV) ; CP B
+        0x28, 0xFB,             // JR Z, -5
+        0x0D,                   // DEC C
+        0x18, 0xE9,             // JR loop
+    };
+    std::copy(program.begin(), program.end(), romData.begin() + 0x100);
+    auto cart = Cart(romData);
+    const auto emu = check_run_for_matches_tick(cart);
+    ez_assert(emu.get_idle_loop_hits() > 0);
+    ez_assert(emu.get_idle_loop_skipped_cycles() > 0);
+
+    // loops that write memory or count can't be skipped
+    const auto busyProgram = std::array<uint8_t, 5>{
+        0x05,       // loop: DEC B
+        0xE0, 0x80, // LDH (0x80), A
+        0x18, 0xFB, // JR loop
+    };
+    std::copy(busyProgram.begin(), busyProgram.end(), romData.begin() + 0x100);
+    auto busyCart = Cart(romData);
+    const auto busyEmu = check_run_for_matches_tick(busyCart);
+    ez_assert(busyEmu.get_idle_loop_hits() == 0);
+
+    // only the flags tell two iterations apart: LY wrapping to 0 sets carry through a CP whose
+    // result is overwritten, the next arrival has to exit rather than skip
+    const auto flagsProgram = std::array<uint8_t, 14>{
+        0x38, 0x08,             // loop: JR C, exit
+        0xF0, 0x44, 0xFE, 0x90, // LDH A, (LY) ; CP 0x90
+        0x3E, 0x00,             // LD A, 0
+        0x18, 0xF6,             // JR loop
+        0x0C, 0xB7,             // exit: INC C ; OR A
+        0x18, 0xF2,             // JR loop
+    };
+    std::copy(flagsProgram.begin(), flagsProgram.end(), romData.begin() + 0x100);
+    auto flagsCart = Cart(romData);
+    const auto flagsEmu = check_run_for_matches_tick(flagsCart);
+    ez_assert(flagsEmu.get_idle_loop_hits() > 0);
+
+    return true;
+}
+
+bool Tester::test_catch_up_sync() {
+    // polls LY/STAT/NR52, toggles the LCD and retriggers a channel once per frame and writes VRAM
+    // whatever mode the PPU is in, so the lagging PPU and APU get synced from every direction
+    auto romData = std::vector<uint8_t>(32 * 1024ull);
+    const auto program = std::array<uint8_t, 47>{
+        0x3E, 0x80, 0xE0, 0x26, // LD A, 0x80 ; LDH (NR52), A
+        0x3E, 0x3F, 0xE0, 0x11, // LD A, 0x3F ; LDH (NR11), A
+        0x3E, 0xF0, 0xE0, 0x12, // LD A, 0xF0 ; LDH (NR12), A
+        0x3E, 0xC0, 0xE0, 0x14, // LD A, 0xC0 ; LDH (NR14), A
+        0xF0, 0x44, 0x47,       // loop: LDH A, (LY) ; LD B, A
+        0xF0, 0x26, 0x4F,       // LDH A, (NR52) ; LD C, A
+        0xF0, 0x41, 0x57,       // LDH A, (STAT) ; LD D, A
+        0x78, 0xFE, 0x90,       // LD A, B ; CP 144
+        0x20, 0xF2,             // JR NZ, loop
+        0x3E, 0x11, 0xE0, 0x40, // LD A, 0x11 ; LDH (LCDC), A
+        0x3E, 0x91, 0xE0, 0x40, // LD A, 0x91 ; LDH (LCDC), A
+        0x3E, 0xC0, 0xE0, 0x14, // LD A, 0xC0 ; LDH (NR14), A
+        0xEA, 0x00, 0x80,       // LD (0x8000), A
+        0x18, 0xE1,             // JR loop
+    };
+    std::copy(program.begin(), program.end(), romData.begin() + 0x100);
+    auto cart = Cart(romData);
+    check_run_for_matches_tick(cart);
+
+    return true;
+}
+
+Cart Tester::make_banked_code_cart() {
+    // runs code out of WRAM, patches it directly and through the echo, then calls the same address
+    // in two ROM banks. Stale blocks would return the old values
+    auto romData = std::vector<uint8_t>(64 * 1024ull);
+    const auto program = std::array<uint8_t, 75>{
+        0x21, 0x00, 0xC0,       // LD HL, 0xC000
+        0x36, 0x3E, 0x23,       // LD (HL), 0x3E ; INC HL   - LD A, 0x11
+        0x36, 0x11, 0x23,       // LD (HL), 0x11 ; INC HL
+        0x36, 0x47, 0x23,       // LD (HL), 0x47 ; INC HL   - LD B, A
+        0x36, 0xC9,             // LD (HL), 0xC9            - RET
+        0xCD, 0x00, 0xC0,       // CALL 0xC000
+        0x78, 0xEA, 0x00, 0xD0, // LD A, B ; LD (0xD000), A
+        0x3E, 0x22,             // LD A, 0x22
+        0xEA, 0x01, 0xC0,       // LD (0xC001), A
+        0xCD, 0x00, 0xC0,       // CALL 0xC000
+        0x78, 0xEA, 0x01, 0xD0, // LD A, B ; LD (0xD001), A
+        0x3E, 0x33,             // LD A, 0x33
+        0xEA, 0x01, 0xE0,       // LD (0xE001), A
+        0xCD, 0x00, 0xC0,       // CALL 0xC000
+        0x78, 0xEA, 0x02, 0xD0, // LD A, B ; LD (0xD002), A
+        0x3E, 0x01,             // LD A, 1
+        0xEA, 0x00, 0x20,       // LD (0x2000), A           - select ROM bank
+        0xCD, 0x00, 0x40,       // CALL 0x4000
+        0xEA, 0x03, 0xD0,       // LD (0xD003), A
+        0x3E, 0x02,             // LD A, 2
+        0xEA, 0x00, 0x20,       // LD (0x2000), A           - select ROM bank
+        0xCD, 0x00, 0x40,       // CALL 0x4000
+        0xEA, 0x04, 0xD0,       // LD (0xD004), A
+        0x18, 0xFE,             // JR -2
+    };
+    // jump over the header
+    romData[0x100] = 0xC3;
+    romData[0x101] = 0x50;
+    romData[0x102] = 0x01;
+    romData[0x147] = +CartType::MBC1;
+    std::copy(program.begin(), program.end(), romData.begin() + 0x150);
+    for (uint8_t bank : {1, 2}) {
+        const auto routine = std::array<uint8_t, 3>{0x3E, bank, 0xC9}; // LD A, bank ; RET
+        std::copy(routine.begin(), routine.end(), romData.begin() + bank * 0x4000);
+    }
+    return Cart(romData);
+}
+
+bool Tester::test_block_cache() {
+    auto cart = make_banked_code_cart();
+    const auto emu = check_run_for_matches_tick(cart);
+    const auto results = std::array<uint8_t, 5>{0x11, 0x22, 0x33, 0x01, 0x02};
+    ez_assert(memcmp(&emu.m_ram[0x1000], results.data(), results.size()) == 0);
+    ez_assert(emu.m_blockCache.size() > 0);
+    ez_assert(emu.m_ramCodePages[0] && !emu.m_ramCodePages[0x10]);
+
+    // the cache and running blocks back to back mustn't change timing
+    auto settings = EmuSettings{};
+    settings.m_skipBootROM = true;
+    settings.m_cpuDispatch = CpuDispatch::TABLE;
+    auto uncached = Emulator(cart, settings);
+    uncached.run_for(emu.get_cycle_counter());
+    ez_assert(memcmp(&uncached.m_reg, &emu.m_reg, sizeof(Reg)) == 0);
+    ez_assert(uncached.get_instruction_counter() == emu.get_instruction_counter());
+    ez_assert(uncached.m_lastCpuCycle == emu.m_lastCpuCycle);
+
+    return true;
+}
+
+// blocks as ezgb_recompile writes them for make_banked_code_cart, which test_recompiler checks
+namespace {
+int g_compiledBlockRuns = 0;
+
+#define STEP(OP, PREFIXED, PC_DATA, SIZE)                                                          \
+    if (const auto step = emu.run_compiled_instr<OP, PREFIXED>(PC_DATA, SIZE, untilCycle);         \
+        step != CompiledStep::NEXT) {                                                              \
+        return step;                                                                               \
+    }
+
+constexpr auto COMPILED_BLOCK_00_0150 = R"(
+    STEP(0x21, false, 0x36C00021, 3) // LD HL u16
+    STEP(0x36, false, 0x36233E36, 2) // LD (HL) u8
+    STEP(0x23, false, 0x23113623, 1) // INC HL
+    STEP(0x36, false, 0x36231136, 2) // LD (HL) u8
+    STEP(0x23, false, 0x23473623, 1) // INC HL
+    STEP(0x36, false, 0x36234736, 2) // LD (HL) u8
+    STEP(0x23, false, 0xCDC93623, 1) // INC HL
+    STEP(0x36, false, 0x00CDC936, 2) // LD (HL) u8
+    STEP(0xCD, false, 0x78C000CD, 3) // CALL a16
+    return CompiledStep::NEXT;
+})";
+CompiledStep block_00_0150(Emulator& emu, int64_t untilCycle) {
+    ++g_compiledBlockRuns;
+    STEP(0x21, false, 0x36C00021, 3) // LD HL u16
+    STEP(0x36, false, 0x36233E36, 2) // LD (HL) u8
+    STEP(0x23, false, 0x23113623, 1) // INC HL
+    STEP(0x36, false, 0x36231136, 2) // LD (HL) u8
+    STEP(0x23, false, 0x23473623, 1) // INC HL
+    STEP(0x36, false, 0x36234736, 2) // LD (HL) u8
+    STEP(0x23, false, 0xCDC93623, 1) // INC HL
+    STEP(0x36, false, 0x00CDC936, 2) // LD (HL) u8
+    STEP(0xCD, false, 0x78C000CD, 3) // CALL a16
+    return CompiledStep::NEXT;
+}
+
+constexpr auto COMPILED_BLOCK_01_4000 = R"(
+    STEP(0x3E, false, 0x00C9013E, 2) // LD A u8
+    STEP(0xC9, false, 0x000000C9, 1) // RET
+    return CompiledStep::NEXT;
+})";
+CompiledStep block_01_4000(Emulator& emu, int64_t untilCycle) {
+    ++g_compiledBlockRuns;
+    STEP(0x3E, false, 0x00C9013E, 2) // LD A u8
+    STEP(0xC9, false, 0x000000C9, 1) // RET
+    return CompiledStep::NEXT;
+}
+
+#undef STEP
+} // namespace
+
+bool Tester::test_recompiler() {
+    auto cart = make_banked_code_cart();
+    const auto rom = cart.get_rom();
+
+    // CALL 0x4000 from bank 0 could land in any bank, return addresses are entry points too
+    const auto blocks = recover_blocks(rom);
+    for (const auto offset : {0x0100u, 0x0150u, 0x0161u, 0x4000u, 0x8000u, 0xC000u}) {
+        ez_assert(std::ranges::any_of(
+            blocks, [&](const RecoveredBlock& block) { return block.get_rom_offset() == offset; }));
+    }
+    const auto source = emit_compiled_rom(rom, blocks, "test");
+    const auto contains = [&](const std::string& text) {
+        return source.find(text) != std::string::npos;
+    };
+    constexpr auto signature = "CompiledStep {}(Emulator& emu, int64_t untilCycle) {{";
+    ez_assert(contains(std::format(signature, "block_00_0150") + COMPILED_BLOCK_00_0150));
+    ez_assert(contains(std::format(signature, "block_01_4000") + COMPILED_BLOCK_01_4000));
+    ez_assert(contains("{0x004000, &block_01_4000}"));
+
+    // the rest runs from the block cache, switching between the two mustn't change timing either
+    const auto compiledBlocks = std::array<CompiledBlock, 2>{{
+        {0x0150, &block_00_0150},
+        {0x4000, &block_01_4000},
+    }};
+    const auto compiledRom = CompiledRom{hash_rom(rom), compiledBlocks};
+    auto settings = EmuSettings{};
+    settings.m_skipBootROM = true;
+    settings.m_compiledRom = &compiledRom;
+    auto emu = Emulator(cart, settings);
+    ez_assert(emu.m_compiledBlocks.size() == compiledBlocks.size());
+    g_compiledBlockRuns = 0;
+    emu.run_for(4 * PPU::DOTS_PER_FRAME);
+    ez_assert(g_compiledBlockRuns == 2);
+    const auto results = std::array<uint8_t, 5>{0x11, 0x22, 0x33, 0x01, 0x02};
+    ez_assert(memcmp(&emu.m_ram[0x1000], results.data(), results.size()) == 0);
+
+    settings.m_compiledRom = nullptr;
+    auto cached = Emulator(cart, settings);
+    cached.run_for(emu.get_cycle_counter());
+    ez_assert(memcmp(&cached.m_reg, &emu.m_reg, sizeof(Reg)) == 0);
+    ez_assert(cached.get_instruction_counter() == emu.get_instruction_counter());
+    ez_assert(cached.m_lastCpuCycle == emu.m_lastCpuCycle);
+
+    // blocks built from a different ROM are ignored
+    auto otherCart = make_cart();
+    settings.m_compiledRom = &compiledRom;
+    ez_assert(Emulator(otherCart, settings).m_compiledBlocks.empty());
+
+    return true;
+}
+
+bool Tester::test_jit() {
+    // calls a WRAM routine often enough for it to get compiled, then patches it, and calls the
+    // same address in two ROM banks in turn. B sums the patched values and D the banks, stale
+    // native code would add the wrong ones
+    auto romData = std::vector<uint8_t>(64 * 1024ull);
+    const auto program = std::array<uint8_t, 65>{
+        0x21, 0x00, 0xC0,       // LD HL, 0xC000
+        0x36, 0x3E, 0x23,       // LD (HL), 0x3E ; INC HL   - LD A, u8
+        0x36, 0x00, 0x23,       // LD (HL), 0x00 ; INC HL
+        0x36, 0x80, 0x23,       // LD (HL), 0x80 ; INC HL   - ADD A, B
+        0x36, 0x47, 0x23,       // LD (HL), 0x47 ; INC HL   - LD B, A
+        0x36, 0xC9,             // LD (HL), 0xC9            - RET
+        0x0E, 0x00, 0x06, 0x00, // LD C, 0 ; LD B, 0
+        0x16, 0x00, 0x1E, 0x00, // LD D, 0 ; LD E, 0
+        0x79, 0xE6, 0x1F,       // loop: LD A, C ; AND 0x1F
+        0x20, 0x05,             // JR NZ, +5
+        0x1C, 0x7B,             // INC E ; LD A, E
+        0xEA, 0x01, 0xC0,       // LD (0xC001), A           - patch the routine every 32 calls
+        0xCD, 0x00, 0xC0,       // CALL 0xC000
+        0xCB, 0x37, 0xCB, 0x37, // SWAP A ; SWAP A
+        0x79, 0xE6, 0x01, 0x3C, // LD A, C ; AND 1 ; INC A
+        0xEA, 0x00, 0x20,       // LD (0x2000), A           - select ROM bank 1 or 2
+        0xCD, 0x00, 0x40,       // CALL 0x4000
+        0x0C,                   // INC C
+        0x20, 0xE2,             // JR NZ, loop
+        0x78, 0xEA, 0x00, 0xD0, // LD A, B ; LD (0xD000), A
+        0x7A, 0xEA, 0x01, 0xD0, // LD A, D ; LD (0xD001), A
+        0x18, 0xFE,             // JR -2
+    };
+    romData[0x100] = 0xC3;
+    romData[0x101] = 0x50;
+    romData[0x102] = 0x01;
+    romData[0x147] = +CartType::MBC1;
+    std::copy(program.begin(), program.end(), romData.begin() + 0x150);
+    for (uint8_t bank : {1, 2}) {
+        // LD A, bank ; ADD A, D ; LD D, A ; RET
+        const auto routine = std::array<uint8_t, 5>{0x3E, bank, 0x82, 0x57, 0xC9};
+        std::copy(routine.begin(), routine.end(), romData.begin() + bank * 0x4000);
+    }
+    auto cart = Cart(romData);
+
+    auto settings = EmuSettings{};
+    settings.m_skipBootROM = true;
+    auto cached = Emulator(cart, settings);
+    settings.m_cpuDispatch = CpuDispatch::JIT;
+    auto jit = Emulator(cart, settings);
+
+    // uneven chunks stop the native code in the middle of blocks, it has to carry on from there
+    const auto chunks = std::array<int64_t, 4>{1, 17, 456, 4099};
+    for (int i = 0; i < 256; ++i) {
+        const auto chunk = chunks[i % chunks.size()];
+        cached.run_for(chunk);
+        jit.run_for(chunk);
+        ez_assert(memcmp(&cached.m_reg, &jit.m_reg, sizeof(Reg)) == 0);
+        ez_assert(cached.get_instruction_counter() == jit.get_instruction_counter());
+        ez_assert(cached.m_lastCpuCycle == jit.m_lastCpuCycle);
+    }
+    // 32 * (1 + ... + 8) and 128 * (1 + 2), both wrapped
+    const auto results = std::array<uint8_t, 2>{0x80, 0x80};
+    ez_assert(memcmp(&jit.m_ram[0x1000], results.data(), results.size()) == 0);
+    ez_assert(memcmp(cached.m_ram.data(), jit.m_ram.data(), jit.m_ram.size()) == 0);
+    ez_assert(cached.m_jit.get_block_count() == 0);
+    if constexpr (Jit::SUPPORTED) {
+        ez_assert(jit.m_jit.get_block_count() > 0);
+    }
+
+    // running out of room starts over, the blocks get compiled again once they're hot
+    jit.m_jit.clear();
+    jit.m_blockCache.clear_jit();
+    jit.m_reg.pc = 0x150;
+    jit.run_for(4 * PPU::DOTS_PER_FRAME);
+    ez_assert(memcmp(&jit.m_ram[0x1000], results.data(), results.size()) == 0);
+    if constexpr (Jit::SUPPORTED) {
+        ez_assert(jit.m_jit.get_block_count() > 0);
+    }
+
+    return true;
+}
+
+bool Tester::test_jit_inline() {
+    // ALU ops, INC/DEC and branches the native code runs itself, mixed with handler calls that
+    // read and write memory or leave the flags lazy. Every result is stored to WRAM
+    auto romData = std::vector<uint8_t>(32 * 1024ull);
+    const auto program = std::array<uint8_t, 57>{
+        0x01, 0x00, 0x00,       // LD BC, 0
+        0x11, 0x34, 0x12,       // LD DE, 0x1234
+        0x21, 0x00, 0xC0,       // LD HL, 0xC000
+        0x78, 0x83, 0x8A, 0x5F, // loop: LD A, B ; ADD A, E ; ADC A, D ; LD E, A
+        0x99, 0xEE, 0x5A,       // SBC A, C ; XOR 0x5A
+        0x14, 0x1D, 0xFE, 0x80, // INC D ; DEC E ; CP 0x80
+        0x38, 0x01, 0x0C,       // JR C, +1 ; INC C
+        0xB2, 0xE6, 0xF3,       // OR D ; AND 0xF3
+        0xD6, 0x11, 0xCE, 0x07, // SUB 0x11 ; ADC 0x07
+        0xDE, 0x03, 0x22, 0x86, // SBC 0x03 ; LD (HL+), A ; ADD A, (HL) - leaves the flags lazy
+        0xD2, 0x76, 0x01, 0x2C, // JP NC, 0x0176 ; INC L
+        0x7C, 0xFE, 0xD0,       // LD A, H ; CP 0xD0
+        0x20, 0x03,             // JR NZ, +3
+        0x21, 0x00, 0xC0,       // LD HL, 0xC000
+        0x3E, 0x03, 0x3D,       // LD A, 3 ; delay: DEC A
+        0x20, 0xFD,             // JR NZ, delay
+        0x05, 0x20, 0xD3,       // DEC B ; JR NZ, loop
+        0xC3, 0x59, 0x01,       // JP loop
+    };
+    romData[0x100] = 0xC3;
+    romData[0x101] = 0x50;
+    romData[0x102] = 0x01;
+    std::copy(program.begin(), program.end(), romData.begin() + 0x150);
+    auto cart = Cart(romData);
+
+    auto settings = EmuSettings{};
+    settings.m_skipBootROM = true;
+    auto cached = Emulator(cart, settings);
+    settings.m_cpuDispatch = CpuDispatch::JIT;
+    auto jit = Emulator(cart, settings);
+
+    const auto chunks = std::array<int64_t, 4>{3, 29, 456, 7001};
+    for (int i = 0; i < 512; ++i) {
+        const auto chunk = chunks[i % chunks.size()];
+        cached.run_for(chunk);
+        jit.run_for(chunk);
+        ez_assert(memcmp(&cached.m_reg, &jit.m_reg, sizeof(Reg)) == 0);
+        ez_assert(cached.get_instruction_counter() == jit.get_instruction_counter());
+        ez_assert(cached.m_lastCpuCycle == jit.m_lastCpuCycle);
+        ez_assert(cached.m_idleLoop.m_start == jit.m_idleLoop.m_start);
+    }
+    ez_assert(memcmp(cached.m_ram.data(), jit.m_ram.data(), jit.m_ram.size()) == 0);
+    if constexpr (Jit::SUPPORTED) {
+        ez_assert(jit.m_jit.get_inline_instr_count() > 0);
+    }
+
     return true;
 }
 
@@ -52,12 +676,184 @@ bool Tester::test_ppu() {
         0b00, 0b00, 0b00, 0b00, 0b11, 0b00, 0b00, 0b11, 0b01, 0b11, 0b11, 0b11, 0b11,
         0b00, 0b00, 0b01, 0b01, 0b01, 0b11, 0b01, 0b11, 0b00, 0b00, 0b11, 0b01, 0b11,
         0b01, 0b11, 0b10, 0b00, 0b00, 0b10, 0b11, 0b11, 0b11, 0b10, 0b00, 0b00};
-    std::array<uint8_t, 64> output;
-    PPU::render_tile(tile.data(), output.data(), PPU::TILE_DIM_XY);
-    for (auto i = 0; i < 64; ++i) {
-        ez_assert(expected[i] == output[i]);
+    // every decoder against the bit at a time definition, whole tiles and odd rows
+    auto planes = std::vector<uint8_t>(2 * 21);
+    for (size_t i = 0; i < planes.size(); ++i) {
+        planes[i] = uint8_t(i * 73 + 11);
+    }
+    for (const auto rowCount : {1, 8, 21}) {
+        auto simd = std::vector<uint8_t>(size_t(rowCount) * PPU::TILE_DIM_XY, 0xFF);
+        auto scalar = simd;
+        decode_2bpp_rows(planes.data(), rowCount, simd.data());
+        decode_2bpp_rows_scalar(planes.data(), rowCount, scalar.data());
+        for (auto px = 0; px < rowCount * PPU::TILE_DIM_XY; ++px) {
+            const auto row = px / PPU::TILE_DIM_XY;
+            const auto bit = 7 - px % PPU::TILE_DIM_XY;
+            const auto expectedPx =
+                (planes[row * 2] >> bit & 1) | (planes[row * 2 + 1] >> bit & 1) << 1;
+            ez_assert(simd[px] == expectedPx && scalar[px] == expectedPx);
+        }
     }
 
+    auto emu = make_emulator();
+    auto& ppu = emu.m_ppu;
+    // written a byte at a time through the PPU, the tile is decoded whole before the next line
+    static constexpr auto tileIdx = 300;
+    const auto tileAddr = uint16_t(PPU::VRAM_ADDR_RANGE.m_min + tileIdx * tile.size());
+    for (size_t i = 0; i < tile.size(); ++i) {
+        ppu.write_addr(uint16_t(tileAddr + i), tile[i]);
+    }
+    const auto decoded = ppu.get_decoded_tile(tileIdx);
+    ez_assert(decoded[0] == 0 && ppu.m_dirtyTiles[tileIdx / 64] == uint64_t(1) << tileIdx % 64);
+    ppu.decode_dirty_tiles();
+    ez_assert(std::ranges::all_of(ppu.m_dirtyTiles, [](uint64_t bits) { return bits == 0; }));
+    for (auto i = 0; i < PPU::PIXELS_PER_TILE; ++i) {
+        ez_assert(expected[i] == decoded[i]);
+    }
+    ez_assert(ppu.get_decoded_tile(tileIdx + 1)[0] == 0);
+
+    // rewriting one byte redecodes its tile
+    ppu.write_addr(uint16_t(tileAddr + 3), 0x00);
+    ppu.decode_dirty_tiles();
+    for (auto i = 0; i < PPU::PIXELS_PER_TILE; ++i) {
+        const auto row = i / PPU::TILE_DIM_XY;
+        ez_assert(decoded[i] == (row == 1 ? expected[i] & 0b01 : expected[i]));
+    }
+
+    // the CPU can't write tile data around the PPU
+    emu.write_addr(tileAddr, 0xFF);
+    ppu.decode_dirty_tiles();
+    ez_assert(decoded[0] == 0b01 && decoded[1] == 0b11);
+
+    // a line matches the same pixels picked out of the whole 256x256 layers
+    auto seed = uint32_t(1);
+    for (auto addr = PPU::VRAM_ADDR_RANGE.m_min; addr < PPU::VRAM_ADDR_RANGE.m_max; ++addr) {
+        seed = seed * 1664525 + 1013904223;
+        ppu.write_addr(uint16_t(addr), uint8_t(seed >> 24));
+    }
+    ppu.decode_dirty_tiles();
+    auto reference = std::vector<uint8_t>(ppu.m_decodedTiles.size());
+    decode_2bpp_rows_scalar(ppu.m_vram.data(), PPU::TILE_COUNT * PPU::TILE_DIM_XY, reference.data());
+    ez_assert(ppu.m_decodedTiles == reference);
+    auto& lcd = emu.m_ioReg->m_lcd;
+    lcd.m_control.m_bgWindowEnable = true;
+    lcd.m_control.m_windowEnable = true;
+    lcd.m_control.m_windowTilemap = true;
+    const auto layers = [&](bool tileMap) {
+        auto layer = std::vector<uint8_t>(PPU::BG_WINDOW_DIM_XY * PPU::BG_WINDOW_DIM_XY);
+        for (auto tileY = 0; tileY < PPU::BG_WINDOW_DIM_XY / PPU::TILE_DIM_XY; ++tileY) {
+            ppu.render_bg_window_row(tileY, true, tileMap, layer.data());
+        }
+        return layer;
+    };
+    for (const auto addrMode : {false, true}) {
+        lcd.m_control.m_bgWindowTileAddrMode = addrMode;
+        const auto bg = layers(false);
+        const auto window = layers(true);
+        for (const auto [scx, scy, wx, wy] : {std::array<int, 4>{0, 0, 7, 0},
+                                              {3, 250, 90, 20},
+                                              {255, 129, 0, 143},
+                                              {77, 5, 166, 0}}) {
+            lcd.m_scx = uint8_t(scx);
+            lcd.m_scy = uint8_t(scy);
+            lcd.m_windowXPlus7 = uint8_t(wx);
+            lcd.m_windowY = uint8_t(wy);
+            for (auto y = 0; y < PPU::DISPLAY_HEIGHT; ++y) {
+                ppu.render_bg_window_line(y);
+                for (auto x = 0; x < PPU::DISPLAY_WIDTH; ++x) {
+                    const auto inWindow = x >= wx - 7 && y >= wy;
+                    const auto expectedIdx =
+                        inWindow ? window[(y - wy) * PPU::BG_WINDOW_DIM_XY + x - (wx - 7)]
+                                 : bg[(y + scy) % 256 * PPU::BG_WINDOW_DIM_XY + (x + scx) % 256];
+                    ez_assert(ppu.m_bgWindowLine[x] == expectedIdx);
+                }
+            }
+        }
+    }
+
+    // palette writes rebuild the LUTs, a line is then just lookups
+    emu.write_addr(+IOAddr::BGP, 0b00'01'10'11);
+    emu.write_addr(+IOAddr::OBP0, 0b11'10'01'00);
+    emu.write_addr(+IOAddr::OBP1, 0b01'01'01'01);
+    for (uint8_t i = 0; i < PPU::PALETTE_COLORS; ++i) {
+        const auto& colors = PPU::DEFAULT_DISPLAY_COLORS;
+        ez_assert(ppu.m_paletteLut[PPU::BGP_LUT_OFFSET + i] == colors[3 - i]);
+        ez_assert(ppu.m_paletteLut[PPU::OBP0_LUT_OFFSET + i] == colors[i]);
+        ez_assert(ppu.m_paletteLut[PPU::OBP1_LUT_OFFSET + i] == colors[1]);
+    }
+    auto displayColors = PPU::DEFAULT_DISPLAY_COLORS;
+    displayColors[3] = rgba8{0x12, 0x34, 0x56, 0xFF};
+    emu.set_display_colors(displayColors);
+    ez_assert(ppu.get_bg_color(0) == displayColors[3]);
+    // they're part of the settings, so an emulator made from them (a reset) keeps them
+    auto resetEmu = Emulator(*m_cart, emu.m_settings);
+    resetEmu.write_addr(+IOAddr::BGP, 0xFF);
+    ez_assert(resetEmu.get_display_colors() == displayColors);
+    ez_assert(resetEmu.m_ppu.get_bg_color(0) == displayColors[3]);
+    lcd.m_ly = 17;
+    ppu.m_spritesAndOamIdxOnLine.clear();
+    ppu.update_scanline();
+    for (auto x = 0; x < PPU::DISPLAY_WIDTH; ++x) {
+        ez_assert(ppu.m_display[17 * PPU::DISPLAY_WIDTH + x] ==
+                  ppu.get_bg_color(ppu.m_bgWindowLine[x]));
+    }
+
+    // a frame in indexed mode expands to the same colours as one drawn in RGBA8
+    lcd.m_control.m_objEnable = true;
+    lcd.m_control.m_ppuEnable = true;
+    const auto drawFrame = [&](DisplayFormat format) {
+        ppu.set_display_format(format);
+        ppu.reset();
+        const auto startFrame = ppu.get_frame_count();
+        while (ppu.get_frame_count() == startFrame) {
+            ppu.tick();
+        }
+    };
+    drawFrame(DisplayFormat::RGBA8);
+    const auto rgbaFrame =
+        std::vector<rgba8>(ppu.m_displayOnLastVBlank.begin(), ppu.m_displayOnLastVBlank.end());
+    drawFrame(DisplayFormat::INDEXED);
+    ez_assert(ppu.m_displayOnLastVBlank == ppu.m_displayOff);
+    auto expanded = std::vector<rgba8>(rgbaFrame.size());
+    emu.expand_display_indices(emu.get_display_indices(), expanded);
+    ez_assert(expanded == rgbaFrame);
+
+    return true;
+}
+
+bool Tester::test_sprite_priority() {
+    // a priority sprite hides behind BG colour index 1-3 and shows over 0, before BGP. BG tile 1
+    // (index 3) then tile 0 (index 0), the sprite over the last 4 pixels of one, first 4 of the other
+    auto emu = make_emulator();
+    auto& ppu = emu.m_ppu;
+    auto& lcd = emu.m_ioReg->m_lcd;
+    lcd.m_control.m_bgWindowEnable = true;
+    lcd.m_control.m_objEnable = true;
+    lcd.m_control.m_bgWindowTileAddrMode = true;
+    for (auto i = 0; i < PPU::BYTES_PER_TILE_COMPRESSED; ++i) {
+        ppu.write_addr(uint16_t(0x8010 + i), 0xFF);
+    }
+    emu.write_addr(0x9800, 1);
+    const auto sprite = std::array<uint8_t, 4>{16, 12, 1, 0x80}; // y, x, tile, behind BG
+    for (auto i = 0; i < 4; ++i) {
+        ppu.write_addr(uint16_t(PPU::OAM_ADDR_RANGE.m_min + i), sprite[i]);
+    }
+    const auto drawLine = [&](uint8_t bgp, uint8_t obp0) {
+        emu.write_addr(+IOAddr::BGP, bgp);
+        emu.write_addr(+IOAddr::OBP0, obp0);
+        lcd.m_ly = 0;
+        ppu.do_oam_scan();
+        ppu.update_scanline();
+    };
+    const auto& line = ppu.m_display;
+    const auto& shades = PPU::DEFAULT_DISPLAY_COLORS;
+    // every BG index shows as shade 0, the sprite still only covers BG index 0
+    drawLine(0x00, 0xFF);
+    ez_assert(line[5] == shades[0] && line[9] == shades[3]);
+    // BG index 0 shows as shade 3, the sprite is still drawn over it
+    drawLine(0xFF, 0b01'00'00'00);
+    ez_assert(line[5] == shades[3] && line[9] == shades[1]);
+
     return true;
 }
 
@@ -167,6 +963,44 @@ bool Tester::test_io_reg() {
     ez_assert(emu.m_ioReg->m_ie.joypad);
     ez_assert(emu.m_ioReg[+IOAddr::IE] & 0b1 << +Interrupts::JOYPAD);
 
+    ez_assert(emu.m_ioReg->m_if.get_mask() == 0b0001'0101);
+    emu.m_ioReg->m_if.request(Interrupts::SERIAL);
+    emu.m_ioReg->m_if.acknowledge(Interrupts::VBLANK);
+    ez_assert(emu.read_addr(+IOAddr::IF) == 0b0001'1100);
+
+    return true;
+}
+
+bool Tester::test_interrupts() {
+    auto emu = make_emulator();
+    emu.m_reg.pc = 0x1234;
+    emu.m_reg.sp = 0xDFF0;
+    emu.write_addr(+IOAddr::IE, 0b0001'1110);
+    emu.write_addr(+IOAddr::IF, 0b1111'1000); // upper bits and disabled ones never fire
+
+    // pending interrupts end HALT even without IME, right after it that's the halt bug
+    emu.m_haltMode = true;
+    emu.m_isInstructionAfterHaltMode = true;
+    ez_assert(!emu.dispatch_interrupts());
+    ez_assert(!emu.m_haltMode && emu.m_haltBugTriggered);
+    ez_assert(!emu.m_isInstructionAfterHaltMode);
+    emu.m_haltBugTriggered = false;
+
+    // highest priority first, one per step
+    emu.m_interruptMasterEnable = true;
+    for (const auto vector : {0x58, 0x60}) {
+        ez_assert(emu.dispatch_interrupts());
+        ez_assert(emu.m_reg.pc == vector && !emu.m_interruptMasterEnable);
+        emu.m_interruptMasterEnable = true;
+    }
+    ez_assert(emu.readAddr16(emu.m_reg.sp) == 0x58);
+    ez_assert(emu.readAddr16(emu.m_reg.sp + 2) == 0x1234);
+    ez_assert(!emu.dispatch_interrupts() && !emu.m_haltBugTriggered);
+    ez_assert(emu.read_addr(+IOAddr::IF) == 0b1110'0000);
+
+    emu.m_ioReg->m_if.request(Interrupts::LCD);
+    ez_assert(emu.dispatch_interrupts() && emu.m_reg.pc == 0x48);
+
     return true;
 }
 
@@ -177,12 +1011,33 @@ bool Tester::test_all() {
     success &= test_flags();
     success &= test_regs();
     success &= test_io_reg();
+    success &= test_interrupts();
     success &= test_inc_dec();
     success &= test_push_pop();
     success &= test_call_ret();
+    success &= test_branch_timing();
     success &= test_cart();
+    success &= test_memory_map();
+    success &= test_dispatch();
     success &= test_ppu();
+    success &= test_sprite_priority();
     success &= test_timer();
+    success &= test_oam_dma();
+    success &= test_scheduler();
+    success &= test_run_for();
+    success &= test_low_pass_filter();
+    success &= test_catch_up_sync();
+    success &= test_halt_fast_forward();
+    success &= test_idle_loops();
+    success &= test_block_cache();
+    success &= test_recompiler();
+    success &= test_jit();
+    success &= test_jit_inline();
+    success &= test_lazy_flags();
+    success &= test_debug_hooks();
+    success &= test_logger();
+    success &= test_trace();
+    success &= test_profiler();
 
     if (success) {
         log_info("All tests passed!");
@@ -221,6 +1076,109 @@ bool Tester::test_cart() {
     offset = cart.get_rom_ptr(0x7FFF) - baseAddr;
     ez_assert(offset == 0x7FFF);
 
+    // the 64KB cart has 4 banks, the memory map can't point into ones past the end
+    cart.m_mbc1State.m_romBankSelect = 3;
+    ez_assert(cart.get_read_ptr(0x4000) == baseAddr + 3 * 0x4000);
+    cart.m_mbc1State.m_romBankSelect = 4;
+    ez_assert(cart.get_read_ptr(0x4000) == nullptr);
+    ez_assert(cart.get_rom_bank() == 4);
+
+    return true;
+}
+
+bool Tester::test_memory_map() {
+    auto romData = std::vector<uint8_t>(64 * 1024ull);
+    romData[0x0147] = +CartType::MBC1_RAM;
+    for (auto bank = 0; bank < 4; ++bank) {
+        romData[bank * 0x4000 + 0x10] = uint8_t(bank);
+    }
+    auto cart = Cart(romData);
+    auto emu = Emulator(cart);
+
+    // bootrom overlays the first page until disabled
+    ez_assert(emu.read_addr(0x0000) == emu.m_bootrom[0]);
+    emu.write_addr(+IOAddr::BANK, 1);
+    ez_assert(emu.read_addr(0x0000) == romData[0]);
+
+    // bank switching remaps 0x4000-0x7FFF
+    ez_assert(emu.read_addr(0x4010) == 1);
+    emu.write_addr(0x2000, 2);
+    ez_assert(emu.read_addr(0x4010) == 2);
+    emu.write_addr(0x2000, 0); // bank 0 selects bank 1
+    ez_assert(emu.read_addr(0x4010) == 1);
+    ez_assert(emu.read_pc_data() == emu.readAddr16(0) + (uint32_t(emu.readAddr16(2)) << 16));
+
+    // external RAM reads back 0xFF until enabled
+    emu.write_addr(0xA000, 0x42);
+    ez_assert(emu.read_addr(0xA000) == 0xFF);
+    emu.write_addr(0x0000, 0x0A);
+    ez_assert(emu.read_addr(0xA000) == 0x42);
+
+    // echo RAM
+    emu.write_addr(0xC123, 0x37);
+    ez_assert(emu.read_addr(0xE123) == 0x37);
+    ez_assert(emu.read_addr(0xD000) == 0);
+
+    // VRAM is locked while the PPU draws
+    emu.write_addr(0x8000, 0x12);
+    emu.m_ioReg->m_lcd.m_control.m_ppuEnable = true;
+    emu.m_ioReg->m_lcd.m_status.m_ppuMode = +PPUMode::DRAWING;
+    emu.map_vram_pages();
+    ez_assert(emu.read_addr(0x8000) == 0xFF);
+    emu.m_ioReg->m_lcd.m_status.m_ppuMode = +PPUMode::HBLANK;
+    emu.map_vram_pages();
+    ez_assert(emu.read_addr(0x8000) == 0x12);
+
+    return true;
+}
+
+bool Tester::test_dispatch() {
+    // the specialised table handlers must match the runtime decoded switch for every opcode
+    auto switchEmu = make_emulator();
+    auto switchCart = std::move(m_cart);
+    auto tableEmu = make_emulator();
+
+    // u16 operand points into WRAM, u8 operand into HRAM
+    const auto pcData = uint32_t(0x00C2'8400);
+    const auto probeAddrs = std::array<uint16_t, 6>{0xC100, 0xC101, 0xDFEC, 0xDFEE, 0xC284, 0xFF84};
+
+    for (auto prefixed : {false, true}) {
+        for (int op = 0; op < 256; ++op) {
+            const auto info =
+                prefixed ? get_opcode_info_prefixed(uint8_t(op)) : get_opcode_info(uint8_t(op));
+            if (std::string_view(info.m_mnemonic).starts_with("ILLEGAL")) {
+                continue;
+            }
+            for (auto* emu : {&switchEmu, &tableEmu}) {
+                emu->m_reg.pc = 0xC000;
+                emu->m_reg.sp = 0xDFF0;
+                emu->write_R16Stack(R16Stack::AF, uint16_t(0x5A00 | ((op & 0xF) << 4)));
+                emu->m_reg.bc = 0x1234;
+                emu->m_reg.de = 0x8F01;
+                emu->m_reg.hl = 0xC100;
+                emu->m_prefix = false;
+                emu->m_haltMode = false;
+            }
+            const auto opData = pcData | uint32_t(op);
+            const auto expected = prefixed ? switchEmu.handle_instr_prefixed(opData)
+                                           : switchEmu.handle_instr(opData);
+            const auto result =
+                prefixed ? Emulator::s_opTablePrefixed<FastPolicy>[op](tableEmu, opData)
+                         : Emulator::s_opTable<FastPolicy>[op](tableEmu, opData);
+
+            ez_assert(expected.m_newPC == result.m_newPC);
+            ez_assert(expected.m_cycles == result.m_cycles);
+            switchEmu.sync_flags();
+            tableEmu.sync_flags();
+            ez_assert(memcmp(&switchEmu.m_reg, &tableEmu.m_reg, sizeof(Reg)) == 0);
+            ez_assert(switchEmu.m_prefix == tableEmu.m_prefix);
+            ez_assert(switchEmu.m_haltMode == tableEmu.m_haltMode);
+            for (auto addr : probeAddrs) {
+                ez_assert(switchEmu.read_addr(addr) == tableEmu.read_addr(addr));
+            }
+        }
+    }
+
     return true;
 }
 
@@ -248,6 +1206,92 @@ bool Tester::test_flags() {
     return true;
 }
 
+bool Tester::test_lazy_flags() {
+    auto emu = make_emulator();
+    const auto run = [&](OpCode op, uint8_t a, uint8_t b, bool carry) {
+        emu.write_R16Stack(R16Stack::AF, uint16_t(a << 8 | (carry ? 0x10 : 0x00)));
+        emu.m_reg.b = b;
+        emu.handle_instr(uint32_t(+op));
+        // reading Z or C on their own has to match the whole of F, which PUSH AF and sync see
+        const auto f = emu.get_f();
+        for (auto flag : {Flag::ZERO, Flag::CARRY, Flag::HALF_CARRY, Flag::NEGATIVE}) {
+            ez_assert(emu.get_flag(flag) == bool(f & (0x1 << +flag)));
+        }
+        ez_assert(emu.read_R16Stack(R16Stack::AF) == (emu.m_reg.a << 8 | f));
+        emu.sync_flags();
+        ez_assert(emu.m_reg.f == f);
+        return f;
+    };
+
+    const auto ops = std::array<OpCode, 10>{
+        OpCode::ADD_A_B, OpCode::ADC_A_B, OpCode::SUB_A_B, OpCode::SBC_A_B, OpCode::AND_A_B,
+        OpCode::XOR_A_B, OpCode::OR_A_B,  OpCode::CP_A_B,  OpCode::INC_A,   OpCode::DEC_A,
+    };
+    for (const auto op : ops) {
+        for (int a = 0; a < 256; ++a) {
+            for (int b = 0; b < 256; b += 17) {
+                run(op, uint8_t(a), uint8_t(b), false);
+                run(op, uint8_t(a), uint8_t(b), true);
+            }
+        }
+    }
+
+    // Z N H C
+    ez_assert(run(OpCode::ADD_A_B, 0x0F, 0x01, false) == 0b0010'0000);
+    ez_assert(run(OpCode::ADD_A_B, 0xFF, 0x01, false) == 0b1011'0000);
+    ez_assert(run(OpCode::ADC_A_B, 0x0E, 0x01, true) == 0b0010'0000);
+    ez_assert(run(OpCode::CP_A_B, 0x42, 0x42, false) == 0b1100'0000);
+    ez_assert(run(OpCode::SBC_A_B, 0x10, 0x0F, true) == 0b1110'0000);
+    ez_assert(run(OpCode::AND_A_B, 0xF0, 0x0F, true) == 0b1010'0000);
+    ez_assert(run(OpCode::INC_A, 0xFF, 0x00, true) == 0b1011'0000); // INC/DEC keep C
+    ez_assert(run(OpCode::DEC_A, 0x01, 0x00, false) == 0b1100'0000);
+
+    // POP AF replaces whatever was pending
+    run(OpCode::CP_A_B, 0x00, 0x00, false);
+    emu.handle_instr(uint32_t(+OpCode::CP_A_B));
+    emu.write_R16Stack(R16Stack::AF, 0x1230);
+    ez_assert(emu.get_f() == 0x30 && !emu.get_flag(Flag::ZERO) && emu.get_flag(Flag::CARRY));
+
+    return true;
+}
+
+bool Tester::test_debug_hooks() {
+    // the hooks mustn't change what runs, only the debug flavour tracks writes
+    auto cart = make_banked_code_cart();
+    auto settings = EmuSettings{};
+    settings.m_skipBootROM = true;
+    auto fast = Emulator(cart, settings);
+    fast.run_for(4 * PPU::DOTS_PER_FRAME);
+    ez_assert(fast.get_last_written_addr() == -2);
+
+    settings.m_debugHooks = true;
+    auto debug = Emulator(cart, settings);
+    debug.run_for(fast.get_cycle_counter());
+    ez_assert(debug.get_last_written_addr() == 0xD004);
+    ez_assert(memcmp(&debug.m_reg, &fast.m_reg, sizeof(Reg)) == 0);
+    ez_assert(debug.get_instruction_counter() == fast.get_instruction_counter());
+    ez_assert(debug.m_lastCpuCycle == fast.m_lastCpuCycle);
+    ez_assert(memcmp(debug.m_ram.data(), fast.m_ram.data(), fast.m_ram.size()) == 0);
+
+    // switching flavour drops the blocks decoded with the other one's handlers
+    ez_assert(fast.m_blockCache.size() > 0 && fast.m_ramCodePages[0]);
+    fast.set_debug_hooks(true);
+    fast.run_for(1);
+    ez_assert(!fast.m_ramCodePages[0]);
+    fast.m_reg.pc = 0x150;
+    fast.run_for(PPU::DOTS_PER_FRAME);
+    ez_assert(fast.m_blockCache.size() > 0);
+    for (const auto& [code, block] : fast.m_blockCache.m_blocks) {
+        for (const auto& instr : block.m_instrs) {
+            const auto& table = instr.m_prefixed ? Emulator::s_opTablePrefixed<DebugPolicy>
+                                                 : Emulator::s_opTable<DebugPolicy>;
+            ez_assert(instr.m_handler == table[instr.m_pcData & 0xFF]);
+        }
+    }
+
+    return true;
+}
+
 bool Tester::test_call_ret() {
     auto emu = make_emulator();
 
@@ -266,6 +1310,41 @@ bool Tester::test_call_ret() {
     return true;
 }
 
+bool Tester::test_branch_timing() {
+    // T-cycles of the NZ form taken and not taken, Z, NC and C follow 8 opcodes apart
+    struct Branch {
+        OpCode m_op;
+        int m_taken;
+        int m_notTaken;
+    };
+    const auto branches = std::array<Branch, 4>{{
+        {OpCode::JR_NZ_i8, 12, 8},
+        {OpCode::JP_NZ_a16, 16, 12},
+        {OpCode::CALL_NZ_a16, 24, 12},
+        {OpCode::RET_NZ, 20, 8},
+    }};
+    auto emu = make_emulator();
+    for (const auto& branch : branches) {
+        for (int cond = 0; cond < 4; ++cond) {
+            const auto op = uint8_t(+branch.m_op + cond * 8);
+            const auto flag = cond < 2 ? Flag::ZERO : Flag::CARRY;
+            for (auto flagSet : {false, true}) {
+                emu.m_reg.pc = 0xC000;
+                emu.m_reg.sp = 0xDFF0;
+                emu.m_reg.f = 0;
+                emu.set_flag(flag, flagSet);
+                const auto taken = flagSet == (cond % 2 == 1);
+                const auto result = emu.handle_instr(uint32_t(op) | uint32_t(0xC110) << 8);
+                const auto nextPC = 0xC000 + OPCODE_TIMINGS[op].m_size;
+                ez_assert((result.m_newPC != nextPC) == taken);
+                ez_assert(result.m_cycles == (taken ? branch.m_taken : branch.m_notTaken));
+            }
+        }
+    }
+
+    return true;
+}
+
 bool Tester::test_push_pop() {
     auto emu = make_emulator();
 
@@ -327,4 +1406,191 @@ bool Tester::test_inc_dec() {
 
     return true;
 }
-} // namespace ez
\ No newline at end of file
+bool Tester::test_logger() {
+    static_assert(is_log_level_enabled(LogLevel::CRITICAL));
+    static_assert(DeferrableLogArg<int> && DeferrableLogArg<IOAddr>);
+    static_assert(!DeferrableLogArg<const char*> && !DeferrableLogArg<std::string>);
+    static_assert(!DeferrableLogArg<std::string_view> && !DeferrableLogArg<std::span<const int>>);
+
+    // trivially copyable arguments are kept as bytes and formatted on the writer thread
+    using Args = std::tuple<int, uint8_t, float>;
+    alignas(std::max_align_t) std::array<std::byte, sizeof(Args)> bytes{};
+    new (bytes.data()) Args(7, uint8_t(0x2A), 1.5f);
+    ez_assert(Logger::format_args<Args>("{} {:#04x} {}", bytes.data()) == "7 0x2a 1.5");
+
+    // each call site gets a burst of messages a second, then counts what it drops
+    auto& logger = Logger::get();
+    const auto location = std::source_location::current();
+    auto suppressed = -1;
+    for (auto i = 0; i < Logger::LOG_SITE_BURST; ++i) {
+        ez_assert(logger.admit(location, suppressed) && suppressed == 0);
+    }
+    ez_assert(!logger.admit(location, suppressed));
+    ez_assert(!logger.admit(location, suppressed));
+    auto site = std::ranges::find_if(logger.m_sites, [&](const Logger::Site& s) {
+        return s.m_file == location.file_name() && s.m_line == location.line();
+    });
+    ez_assert(site != logger.m_sites.end() && site->m_suppressed == 2);
+    site->m_windowStart -= 2'000'000'000; // two seconds later
+    ez_assert(logger.admit(location, suppressed) && site->m_count == 1);
+
+    log_info("Logger test message {}", 42);
+    logger.flush();
+    ez_assert(logger.m_written == logger.m_head);
+
+    // the instruction log isn't limited and nothing is dropped even when it fills the ring
+    const auto head = logger.m_head.load();
+    for (size_t i = 0; i < Logger::CAPACITY * 2; ++i) {
+        log_verbose("Logger verbose test message {}", i);
+    }
+    logger.flush();
+    ez_assert(logger.m_head == head + Logger::CAPACITY * 2 && logger.m_dropped == 0);
+
+    // with the ring full, errors are written from the calling thread rather than dropped
+    auto claimed = std::vector<Logger::Slot*>{};
+    while (auto* slot = logger.begin_push()) {
+        slot->m_record.m_formatArgs = nullptr;
+        slot->m_record.m_text = "Logger test filler";
+        claimed.push_back(slot);
+    }
+    // pushed directly, log_error would wait for the claimed slots to be written
+    const auto here = std::source_location::current();
+    logger.push(LogLevel::ERROR, here, 0, false, "Logger test error with the ring full");
+    logger.push(LogLevel::INFO, here, 0, false, "Logger test info with the ring full");
+    ez_assert(logger.m_dropped == 1);
+    for (auto* slot : claimed) {
+        logger.end_push(slot);
+    }
+    logger.flush();
+
+    // an error its call site isn't allowed to log doesn't flush, that would wait on the filler
+    const auto logStorm = [] { log_error("Logger test error storm"); };
+    for (auto i = 0; i < Logger::LOG_SITE_BURST; ++i) {
+        logStorm();
+    }
+    claimed.clear();
+    while (auto* slot = logger.begin_push()) {
+        slot->m_record.m_formatArgs = nullptr;
+        slot->m_record.m_text = "Logger test filler";
+        claimed.push_back(slot);
+    }
+    const auto stormHead = logger.m_head.load();
+    logStorm();
+    ez_assert(logger.m_head == stormHead);
+    for (auto* slot : claimed) {
+        logger.end_push(slot);
+    }
+    logger.flush();
+
+    return true;
+}
+
+bool Tester::test_trace() {
+    // chunks round trip, whatever the deltas look like
+    auto records = std::vector<TraceRecord>(5000);
+    for (size_t i = 0; i < records.size(); ++i) {
+        auto& record = records[i];
+        record.m_cycle = int64_t(i) * 12 + (i % 7 == 0 ? 1'000'000 : 0);
+        record.m_pc = uint16_t(0x150 + i % 40);
+        record.m_opcode = uint8_t(i * 37);
+        record.m_af = uint16_t(i * 0x1F0);
+        record.m_sp = 0xFFFE;
+    }
+    const auto compressed = compress_trace_chunk(records);
+    ez_assert(compressed.size() < records.size() * sizeof(TraceRecord) / 2);
+    auto decompressed = std::vector<TraceRecord>(records.size());
+    ez_assert(decompress_trace_chunk(compressed, decompressed) && decompressed == records);
+    ez_assert(!decompress_trace_chunk(std::span(compressed).first(compressed.size() / 2),
+                                      decompressed));
+
+    // a trace of NOPs from 0x100, one record per instruction
+    const auto path = fs::temp_directory_path() / "ezgb_test_trace.bin";
+    auto cart = make_cart();
+    auto settings = EmuSettings{};
+    settings.m_skipBootROM = true;
+    auto emu = Emulator(cart, settings);
+    ez_assert(emu.start_trace(path));
+    emu.run_for(TraceWriter::RECORDS_PER_CHUNK * T_CYCLES_PER_M_CYCLE * 2 + 100);
+    const auto instructions = emu.get_instruction_counter();
+    emu.stop_trace();
+
+    auto reader = TraceReader(path);
+    ez_assert(reader.is_open() && reader.size() == instructions);
+    const auto first = reader.get(0);
+    ez_assert(first && first->m_pc == 0x100 && first->m_opcode == 0x00 && first->m_bank == 1);
+    const auto last = reader.get(reader.size() - 1);
+    ez_assert(last && last->m_pc == uint16_t(0x100 + reader.size() - 1));
+    ez_assert(last->m_cycle - first->m_cycle == (reader.size() - 1) * T_CYCLES_PER_M_CYCLE);
+    ez_assert(!reader.get(reader.size()));
+
+    // polling LY, which would be skipped without the trace
+    auto rom = std::vector<uint8_t>(32 * 1024ull);
+    const auto pollLoop = std::array<uint8_t, 6>{0xF0, 0x44, 0xFE, 0x90, 0x20, 0xFA};
+    std::ranges::copy(pollLoop, rom.begin() + 0x100);
+    auto pollCart = Cart(rom);
+    auto pollEmu = Emulator(pollCart, settings);
+    ez_assert(pollEmu.start_trace(path));
+    pollEmu.run_for(PPU::DOTS_PER_FRAME);
+    pollEmu.stop_trace();
+    ez_assert(pollEmu.get_idle_loop_hits() == 0);
+    ez_assert(TraceReader(path).size() == pollEmu.get_instruction_counter());
+    fs::remove(path);
+
+    return true;
+}
+
+bool Tester::test_profiler() {
+    // swap a, jr back to it, forever
+    auto rom = std::vector<uint8_t>(32 * 1024ull);
+    const auto loop = std::array<uint8_t, 4>{0xCB, 0x37, 0x18, 0xFC};
+    std::ranges::copy(loop, rom.begin() + 0x100);
+    auto cart = Cart(rom);
+    auto settings = EmuSettings{};
+    settings.m_skipBootROM = true;
+    settings.m_skipIdleLoops = false;
+    auto emu = Emulator(cart, settings);
+    ez_assert(!emu.get_profiler());
+
+    static constexpr auto iterations = 1000;
+    emu.start_profiling();
+    emu.run_for(iterations * 20);
+    emu.stop_profiling();
+    const auto& profiler = *emu.get_profiler();
+    ez_assert(profiler.get_total_hits() == emu.get_instruction_counter());
+    ez_assert(profiler.get_total_cycles() == iterations * 20);
+
+    // jr takes the most, the prefix and the swap after it are counted apart
+    const auto hotSpots = profiler.get_hot_spots(2);
+    ez_assert(hotSpots.size() == 2);
+    ez_assert(hotSpots[0].m_bank == 0 && hotSpots[0].m_pc == 0x102 && hotSpots[0].m_opcode == 0x18);
+    ez_assert(hotSpots[0].m_hits == iterations && hotSpots[0].m_cycles == iterations * 12);
+    ez_assert(hotSpots[1].m_cycles == iterations * 4);
+    const auto opcodes = profiler.get_opcodes();
+    ez_assert(opcodes.size() == 3 && opcodes[0].m_opcode == 0x18);
+    ez_assert(std::ranges::count_if(opcodes, [](const auto& op) {
+                  return op.m_prefixed && op.m_opcode == 0x37 && op.m_hits == iterations;
+              }) == 1);
+
+    // stopped, nothing more is counted
+    emu.run_for(1000);
+    ez_assert(profiler.get_total_cycles() == iterations * 20);
+    ez_assert(profiler.to_json(10).find(R"("bank": 0, "pc": "0102")") != std::string::npos);
+    ez_assert(profiler.to_csv(10).find("pc,0,0102,18,JR i8,12000,1000") != std::string::npos);
+
+    // polling LY isn't skipped while profiling, its iterations are the hot spot
+    const auto pollLoop = std::array<uint8_t, 6>{0xF0, 0x44, 0xFE, 0x90, 0x20, 0xFA};
+    std::ranges::copy(pollLoop, rom.begin() + 0x100);
+    auto pollCart = Cart(rom);
+    settings.m_skipIdleLoops = true;
+    auto pollEmu = Emulator(pollCart, settings);
+    pollEmu.start_profiling();
+    pollEmu.run_for(PPU::DOTS_PER_FRAME);
+    pollEmu.stop_profiling();
+    ez_assert(pollEmu.get_idle_loop_hits() == 0);
+    ez_assert(pollEmu.get_profiler()->get_total_hits() == pollEmu.get_instruction_counter());
+    ez_assert(pollEmu.get_profiler()->get_hot_spots(1)[0].m_pc == 0x100);
+
+    return true;
+}
+
+} // namespace ez
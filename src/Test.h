@@ -12,16 +12,39 @@ class Tester {
   protected:
     Emulator make_emulator();
     Cart make_cart();
-    
+    Emulator check_run_for_matches_tick(Cart& cart); // asserts tick and chunked run_for agree
+    Cart make_banked_code_cart(); // MBC1, runs code from WRAM and two ROM banks
+
     bool test_flags();
     bool test_regs();
     bool test_inc_dec();
     bool test_push_pop();
     bool test_io_reg();
+    bool test_interrupts();
     bool test_call_ret();
+    bool test_branch_timing();
     bool test_cart();
+    bool test_memory_map();
+    bool test_dispatch();
     bool test_ppu();
+    bool test_sprite_priority();
     bool test_timer();
+    bool test_oam_dma();
+    bool test_scheduler();
+    bool test_run_for();
+    bool test_low_pass_filter();
+    bool test_catch_up_sync();
+    bool test_halt_fast_forward();
+    bool test_idle_loops();
+    bool test_block_cache();
+    bool test_recompiler();
+    bool test_jit();
+    bool test_jit_inline();
+    bool test_lazy_flags();
+    bool test_debug_hooks();
+    bool test_logger();
+    bool test_trace();
+    bool test_profiler();
 
     std::unique_ptr<Cart> m_cart;
 };
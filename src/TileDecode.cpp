@@ -0,0 +1,116 @@
+#include "TileDecode.h"
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #define EZ_TILE_DECODE_SSE2 1
+    #include <emmintrin.h>
+#elif defined(__ARM_NEON)
+    #define EZ_TILE_DECODE_NEON 1
+    #include <arm_neon.h>
+#endif
+
+namespace ez {
+
+namespace {
+
+constexpr int PIXELS_PER_ROW = 8;
+constexpr int BYTES_PER_ROW = 2;
+
+// every bit of a byte moved to the bottom of its own byte, the top bit in the lowest byte
+EZ_FORCE_INLINE uint64_t spread_bits(uint8_t byte) {
+    // each byte of the product holds the whole input, the mask keeps a different bit of each
+    const auto bits = (byte * 0x0101010101010101ull) & 0x0102040810204080ull;
+    // 0x7F carries into the top bit of every byte that kept its bit, never into the next byte
+    return ((bits + 0x7F7F7F7F7F7F7F7Full) >> 7) & 0x0101010101010101ull;
+}
+
+#if EZ_TILE_DECODE_SSE2
+
+// two rows from a register of each one's low plane byte eight times then the next one's, and the
+// same for the high planes
+EZ_FORCE_INLINE __m128i decode_row_pair_sse2(__m128i low, __m128i high) {
+    const auto bitMask = _mm_set1_epi64x(0x0102040810204080ll);
+    const auto one = _mm_set1_epi8(1);
+    // each lane is its bit or 0, min with 1 makes it 1 or 0
+    const auto lowBits = _mm_min_epu8(_mm_and_si128(low, bitMask), one);
+    const auto highBits = _mm_min_epu8(_mm_and_si128(high, bitMask), one);
+    return _mm_or_si128(lowBits, _mm_add_epi8(highBits, highBits));
+}
+
+// a whole tile, eight rows, at a time. The planes are split apart, then unpacking a register with
+// itself three times over spreads each byte over eight lanes
+EZ_FORCE_INLINE void decode_tile_sse2(const uint8_t* rows, uint8_t* dst) {
+    const auto tile = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows));
+    const auto lowWords = _mm_and_si128(tile, _mm_set1_epi16(0x00FF));
+    const auto highWords = _mm_srli_epi16(tile, 8);
+    const auto planes = _mm_packus_epi16(lowWords, highWords); // 8 low bytes, then 8 high
+    const auto low2 = _mm_unpacklo_epi8(planes, planes);
+    const auto high2 = _mm_unpackhi_epi8(planes, planes);
+    const __m128i low4[] = {_mm_unpacklo_epi16(low2, low2), _mm_unpackhi_epi16(low2, low2)};
+    const __m128i high4[] = {_mm_unpacklo_epi16(high2, high2), _mm_unpackhi_epi16(high2, high2)};
+    auto* const out = reinterpret_cast<__m128i*>(dst);
+    for (auto half = 0; half < 2; ++half) {
+        _mm_storeu_si128(out + half * 2,
+                         decode_row_pair_sse2(_mm_unpacklo_epi32(low4[half], low4[half]),
+                                              _mm_unpacklo_epi32(high4[half], high4[half])));
+        _mm_storeu_si128(out + half * 2 + 1,
+                         decode_row_pair_sse2(_mm_unpackhi_epi32(low4[half], low4[half]),
+                                              _mm_unpackhi_epi32(high4[half], high4[half])));
+    }
+}
+
+#elif EZ_TILE_DECODE_NEON
+
+EZ_FORCE_INLINE void decode_row_neon(uint8_t low, uint8_t high, uint8_t* dst) {
+    static constexpr uint8_t bitMaskBytes[PIXELS_PER_ROW] = {0x80, 0x40, 0x20, 0x10,
+                                                             0x08, 0x04, 0x02, 0x01};
+    const auto bitMask = vld1_u8(bitMaskBytes);
+    // vtst sets every bit of a lane where the AND is non-zero
+    const auto lowSet = vtst_u8(vdup_n_u8(low), bitMask);
+    const auto highSet = vtst_u8(vdup_n_u8(high), bitMask);
+    vst1_u8(dst, vorr_u8(vand_u8(lowSet, vdup_n_u8(1)), vand_u8(highSet, vdup_n_u8(2))));
+}
+
+#endif
+
+} // namespace
+
+void decode_2bpp_rows_scalar(const uint8_t* rows, int rowCount, uint8_t* dst) {
+    static_assert(std::endian::native == std::endian::little);
+    for (auto row = 0; row < rowCount; ++row) {
+        const auto pixels = spread_bits(rows[row * BYTES_PER_ROW]) |
+                            spread_bits(rows[row * BYTES_PER_ROW + 1]) << 1;
+        memcpy(dst + row * PIXELS_PER_ROW, &pixels, sizeof(pixels));
+    }
+}
+
+void decode_2bpp_rows(const uint8_t* rows, int rowCount, uint8_t* dst) {
+#if EZ_TILE_DECODE_SSE2
+    static constexpr auto rowsPerTile = 8;
+    auto row = 0;
+    for (; row + rowsPerTile <= rowCount; row += rowsPerTile) {
+        decode_tile_sse2(rows + row * BYTES_PER_ROW, dst + row * PIXELS_PER_ROW);
+    }
+    // a row on its own is no quicker in a vector register
+    decode_2bpp_rows_scalar(rows + row * BYTES_PER_ROW, rowCount - row, dst + row * PIXELS_PER_ROW);
+#elif EZ_TILE_DECODE_NEON
+    for (auto row = 0; row < rowCount; ++row) {
+        decode_row_neon(rows[row * BYTES_PER_ROW], rows[row * BYTES_PER_ROW + 1],
+                        dst + row * PIXELS_PER_ROW);
+    }
+#else
+    decode_2bpp_rows_scalar(rows, rowCount, dst);
+#endif
+}
+
+const char* get_2bpp_decoder_name() {
+#if EZ_TILE_DECODE_SSE2
+    return "sse2";
+#elif EZ_TILE_DECODE_NEON
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+} // namespace ez
@@ -0,0 +1,20 @@
+#pragma once
+#include "Base.h"
+
+namespace ez {
+
+// Game Boy 2bpp tile data to one colour index (0-3) per pixel.
+//
+// A row is two bytes, the low bitplane then the high one, with the leftmost pixel in the top bit.
+// decode_2bpp_rows picks SSE2 or NEON at build time where the target has it, otherwise it's
+// decode_2bpp_rows_scalar. SSE2 only pays off a whole tile at a time, rows left over go through
+// the scalar one, so the PPU decodes whole tiles. ezgb_bench --tiles times them
+
+// rowCount rows from rows, rowCount * 8 pixels to dst
+void decode_2bpp_rows(const uint8_t* rows, int rowCount, uint8_t* dst);
+void decode_2bpp_rows_scalar(const uint8_t* rows, int rowCount, uint8_t* dst);
+
+// "sse2", "neon" or "scalar"
+const char* get_2bpp_decoder_name();
+
+} // namespace ez
@@ -0,0 +1,252 @@
+#include "Trace.h"
+#include "OpCodes.h"
+#include <bit>
+
+#if !EZ_MSVC && !EZ_WASM
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace ez {
+namespace {
+
+constexpr auto RECORD_BYTES = sizeof(TraceRecord);
+
+// PackBits: a control byte below 128 is followed by that many plus one literal bytes, from 128 up
+// it's followed by one byte repeated control - 125 times
+constexpr size_t MAX_LITERALS = 128;
+constexpr size_t MIN_RUN = 3;
+constexpr size_t MAX_RUN = 255 - 128 + MIN_RUN;
+
+// the cycle as one 64 bit word, everything after it as 16 bit words
+struct RecordWords {
+    uint64_t m_cycle = 0;
+    std::array<uint16_t, 8> m_words{};
+};
+static_assert(sizeof(RecordWords) == RECORD_BYTES);
+
+using RecordBytes = std::array<uint8_t, RECORD_BYTES>;
+
+void pack_bits(std::span<const uint8_t> in, std::vector<uint8_t>& out) {
+    size_t i = 0;
+    while (i < in.size()) {
+        auto run = size_t(1);
+        while (i + run < in.size() && run < MAX_RUN && in[i + run] == in[i]) {
+            ++run;
+        }
+        if (run >= MIN_RUN) {
+            out.push_back(uint8_t(run - MIN_RUN + 128));
+            out.push_back(in[i]);
+            i += run;
+            continue;
+        }
+        const auto start = i;
+        while (i < in.size() && i - start < MAX_LITERALS &&
+               !(i + 2 < in.size() && in[i] == in[i + 1] && in[i] == in[i + 2])) {
+            ++i;
+        }
+        out.push_back(uint8_t(i - start - 1));
+        out.insert(out.end(), in.begin() + start, in.begin() + i);
+    }
+}
+
+bool unpack_bits(std::span<const uint8_t> in, std::span<uint8_t> out) {
+    size_t read = 0;
+    size_t written = 0;
+    while (read < in.size()) {
+        const auto control = in[read++];
+        if (control < 128) {
+            const auto count = size_t(control) + 1;
+            if (read + count > in.size() || written + count > out.size()) {
+                return false;
+            }
+            memcpy(out.data() + written, in.data() + read, count);
+            read += count;
+            written += count;
+        } else {
+            const auto count = size_t(control) - 128 + MIN_RUN;
+            if (read >= in.size() || written + count > out.size()) {
+                return false;
+            }
+            memset(out.data() + written, in[read++], count);
+            written += count;
+        }
+    }
+    return written == out.size();
+}
+
+} // namespace
+
+std::string to_string(const TraceRecord& record) {
+    const auto prefixed = bool(record.m_status & +TraceStatus::PREFIXED);
+    const auto& details =
+        prefixed ? OPCODE_DETAILS_PREFIXED[record.m_opcode] : OPCODE_DETAILS[record.m_opcode];
+    auto mnemonic = std::format("{} {} {}", details.m_mnemonic, details.m_operandName1,
+                                details.m_operandName2);
+    mnemonic.erase(mnemonic.find_last_not_of(' ') + 1);
+    return std::format("{:>12} {:02x}:{:04x} {}{:02x} {:<14} AF {:04x} BC {:04x} DE {:04x} "
+                       "HL {:04x} SP {:04x}{}",
+                       record.m_cycle, record.m_bank, record.m_pc, prefixed ? "cb" : "  ",
+                       record.m_opcode, mnemonic, record.m_af, record.m_bc, record.m_de,
+                       record.m_hl, record.m_sp,
+                       record.m_status & +TraceStatus::IME ? " IME" : "");
+}
+
+std::vector<uint8_t> compress_trace_chunk(std::span<const TraceRecord> records) {
+    const auto count = records.size();
+    auto planes = std::vector<uint8_t>(count * RECORD_BYTES);
+    auto prev = RecordWords{};
+    for (size_t i = 0; i < count; ++i) {
+        const auto words = std::bit_cast<RecordWords>(records[i]);
+        auto delta = RecordWords{};
+        delta.m_cycle = words.m_cycle - prev.m_cycle;
+        for (size_t w = 0; w < words.m_words.size(); ++w) {
+            delta.m_words[w] = uint16_t(words.m_words[w] - prev.m_words[w]);
+        }
+        const auto bytes = std::bit_cast<RecordBytes>(delta);
+        for (size_t b = 0; b < RECORD_BYTES; ++b) {
+            planes[b * count + i] = bytes[b];
+        }
+        prev = words;
+    }
+
+    auto compressed = std::vector<uint8_t>{};
+    compressed.reserve(planes.size() / 4);
+    pack_bits(planes, compressed);
+    return compressed;
+}
+
+bool decompress_trace_chunk(std::span<const uint8_t> compressed, std::span<TraceRecord> records) {
+    const auto count = records.size();
+    auto planes = std::vector<uint8_t>(count * RECORD_BYTES);
+    if (!unpack_bits(compressed, planes)) {
+        return false;
+    }
+    auto prev = RecordWords{};
+    for (size_t i = 0; i < count; ++i) {
+        auto bytes = RecordBytes{};
+        for (size_t b = 0; b < RECORD_BYTES; ++b) {
+            bytes[b] = planes[b * count + i];
+        }
+        auto words = std::bit_cast<RecordWords>(bytes);
+        words.m_cycle += prev.m_cycle;
+        for (size_t w = 0; w < words.m_words.size(); ++w) {
+            words.m_words[w] = uint16_t(words.m_words[w] + prev.m_words[w]);
+        }
+        records[i] = std::bit_cast<TraceRecord>(words);
+        prev = words;
+    }
+    return true;
+}
+
+TraceWriter::TraceWriter(const fs::path& path) : m_file(path, std::ios::binary) {
+    if (!m_file) {
+        log_error("Failed to open trace file: {}", path.string());
+        return;
+    }
+    const auto header = TraceFileHeader{.m_recordsPerChunk = RECORDS_PER_CHUNK};
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    m_chunk.reserve(RECORDS_PER_CHUNK);
+}
+
+TraceWriter::~TraceWriter() {
+    if (!m_chunk.empty()) {
+        write_chunk();
+    }
+}
+
+void TraceWriter::write_chunk() {
+    if (m_file) {
+        const auto compressed = compress_trace_chunk(m_chunk);
+        const auto header = TraceChunkHeader{uint32_t(m_chunk.size()), uint32_t(compressed.size())};
+        m_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        m_file.write(reinterpret_cast<const char*>(compressed.data()),
+                     std::streamsize(compressed.size()));
+    }
+    m_recordsWritten += int64_t(m_chunk.size());
+    m_chunk.clear();
+}
+
+TraceReader::TraceReader(const fs::path& path) {
+#if !EZ_MSVC && !EZ_WASM
+    const auto fd = open(path.c_str(), O_RDONLY);
+    struct stat info {};
+    if (fd >= 0 && fstat(fd, &info) == 0 && info.st_size > 0) {
+        const auto bytes = size_t(info.st_size);
+        const auto mapping = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            m_mapping = mapping;
+            m_data = {static_cast<const uint8_t*>(mapping), bytes};
+        }
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+#else
+    auto file = std::ifstream(path, std::ios::binary);
+    m_fallback.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    m_data = m_fallback;
+#endif
+    if (m_data.empty()) {
+        log_error("Failed to open trace file: {}", path.string());
+        return;
+    }
+
+    auto header = TraceFileHeader{};
+    if (m_data.size() < sizeof(header)) {
+        log_error("Not a trace file: {}", path.string());
+        return;
+    }
+    memcpy(&header, m_data.data(), sizeof(header));
+    if (header.m_magic != TraceFileHeader::MAGIC || header.m_recordSize != sizeof(TraceRecord)) {
+        log_error("Not a trace file or from an incompatible version: {}", path.string());
+        return;
+    }
+
+    auto offset = sizeof(header);
+    while (offset + sizeof(TraceChunkHeader) <= m_data.size()) {
+        auto chunkHeader = TraceChunkHeader{};
+        memcpy(&chunkHeader, m_data.data() + offset, sizeof(chunkHeader));
+        offset += sizeof(chunkHeader);
+        if (offset + chunkHeader.m_compressedBytes > m_data.size()) {
+            log_warn("Trace {} is truncated after {} records", path.string(), m_recordCount);
+            break;
+        }
+        m_chunks.push_back({m_recordCount, chunkHeader.m_recordCount,
+                            m_data.subspan(offset, chunkHeader.m_compressedBytes)});
+        m_recordCount += chunkHeader.m_recordCount;
+        offset += chunkHeader.m_compressedBytes;
+    }
+    m_open = true;
+}
+
+TraceReader::~TraceReader() {
+#if !EZ_MSVC && !EZ_WASM
+    if (m_mapping) {
+        munmap(m_mapping, m_data.size());
+    }
+#endif
+}
+
+std::optional<TraceRecord> TraceReader::get(int64_t index) {
+    if (index < 0 || index >= m_recordCount) {
+        return std::nullopt;
+    }
+    const auto cached = m_cachedChunk >= 0 ? &m_chunks[m_cachedChunk] : nullptr;
+    if (!cached || index < cached->m_firstRecord ||
+        index >= cached->m_firstRecord + cached->m_recordCount) {
+        const auto it = std::ranges::upper_bound(m_chunks, index, {}, &Chunk::m_firstRecord) - 1;
+        m_cachedRecords.resize(it->m_recordCount);
+        if (!decompress_trace_chunk(it->m_compressed, m_cachedRecords)) {
+            log_error("Trace chunk at record {} is corrupt", it->m_firstRecord);
+            m_cachedChunk = -1;
+            return std::nullopt;
+        }
+        m_cachedChunk = int(it - m_chunks.begin());
+    }
+    return m_cachedRecords[size_t(index - m_chunks[m_cachedChunk].m_firstRecord)];
+}
+
+} // namespace ez
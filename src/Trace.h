@@ -0,0 +1,111 @@
+#pragma once
+#include "Base.h"
+
+namespace ez {
+
+// Binary execution traces, one record per instruction, for diffing runs between builds.
+//
+// A trace file is a TraceFileHeader followed by chunks of up to RECORDS_PER_CHUNK records. Each
+// chunk is a TraceChunkHeader and the records compressed independently of every other chunk:
+// every field is stored as the difference from the record before it, the deltas are split into
+// byte planes (all the first bytes, then all the second bytes...) so the mostly-zero high bytes
+// sit together, and the planes are run-length encoded
+
+struct TraceRecord {
+    int64_t m_cycle = 0; // when the instruction started
+    uint16_t m_pc = 0;
+    uint16_t m_bank = 0; // ROM bank mapped at 0x4000
+    uint8_t m_opcode = 0;
+    uint8_t m_status = 0; // TraceStatus bits
+    uint16_t m_af = 0;
+    uint16_t m_bc = 0;
+    uint16_t m_de = 0;
+    uint16_t m_hl = 0;
+    uint16_t m_sp = 0;
+
+    bool operator==(const TraceRecord&) const = default;
+};
+static_assert(sizeof(TraceRecord) == 24 && std::has_unique_object_representations_v<TraceRecord>);
+
+enum class TraceStatus : uint8_t {
+    PREFIXED = 1 << 0, // m_opcode is the second half of a CB instruction
+    IME = 1 << 1,
+};
+
+struct TraceFileHeader {
+    static constexpr std::array<char, 8> MAGIC = {'E', 'Z', 'T', 'R', 'A', 'C', 'E', '1'};
+
+    std::array<char, 8> m_magic = MAGIC;
+    uint32_t m_recordSize = sizeof(TraceRecord);
+    uint32_t m_recordsPerChunk = 0;
+};
+
+struct TraceChunkHeader {
+    uint32_t m_recordCount = 0;
+    uint32_t m_compressedBytes = 0; // following this header
+};
+
+// "cycle 1234 pc 0150 bank 01 op 3e A 01 F b0 BC 0013 DE 00d8 HL 014d SP fffe"
+std::string to_string(const TraceRecord& record);
+
+// chunk encoding, exposed for the tests
+std::vector<uint8_t> compress_trace_chunk(std::span<const TraceRecord> records);
+bool decompress_trace_chunk(std::span<const uint8_t> compressed, std::span<TraceRecord> records);
+
+class TraceWriter {
+  public:
+    static constexpr uint32_t RECORDS_PER_CHUNK = 4096;
+
+    explicit TraceWriter(const fs::path& path);
+    ~TraceWriter(); // writes whatever is left of the last chunk
+    EZ_DECLARE_COPY_MOVE(TraceWriter, delete, delete);
+
+    bool is_open() const { return bool(m_file); }
+    void record(const TraceRecord& record) {
+        m_chunk.push_back(record);
+        if (m_chunk.size() == RECORDS_PER_CHUNK) {
+            write_chunk();
+        }
+    }
+    int64_t get_record_count() const { return m_recordsWritten + int64_t(m_chunk.size()); }
+
+  private:
+    void write_chunk();
+
+    std::ofstream m_file;
+    std::vector<TraceRecord> m_chunk;
+    int64_t m_recordsWritten = 0;
+};
+
+// Maps the whole file and indexes its chunks up front, records are decompressed a chunk at a time
+// as they're asked for
+class TraceReader {
+  public:
+    explicit TraceReader(const fs::path& path);
+    ~TraceReader();
+    EZ_DECLARE_COPY_MOVE(TraceReader, delete, delete);
+
+    bool is_open() const { return m_open; }
+    int64_t size() const { return m_recordCount; }
+    // nullopt past the end or if the chunk holding it is corrupt
+    std::optional<TraceRecord> get(int64_t index);
+
+  private:
+    struct Chunk {
+        int64_t m_firstRecord = 0;
+        uint32_t m_recordCount = 0;
+        std::span<const uint8_t> m_compressed;
+    };
+
+    std::span<const uint8_t> m_data; // the whole file
+    void* m_mapping = nullptr;
+    std::vector<uint8_t> m_fallback; // the file read into memory where mapping isn't available
+    std::vector<Chunk> m_chunks;
+    int64_t m_recordCount = 0;
+    bool m_open = false;
+
+    int m_cachedChunk = -1;
+    std::vector<TraceRecord> m_cachedRecords;
+};
+
+} // namespace ez
@@ -183,7 +183,7 @@ void Window::init_audio() {
     SDL_AudioSpec specDesired{};
     specDesired.freq = audio::SAMPLE_RATE;
     specDesired.channels = 2;
-    specDesired.format = audio::FORMAT;
+    specDesired.format = AUDIO_F32; // matches audio::Sample
     specDesired.samples = audio::BUFFER_SIZE;
     specDesired.callback = audio_callback;
     specDesired.userdata = this;
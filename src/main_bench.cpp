@@ -0,0 +1,209 @@
+#include "Base.h"
+#include "Cart.h"
+#include "Emulator.h"
+#include "TileDecode.h"
+
+// CPU benchmark - runs a ROM for a fixed number of frames with each dispatch mode, with and without
+// the debug hooks, and reports the wall time of each, e.g. against
+// roms/test/blargg/cpu_instrs/cpu_instrs.gb
+//
+// usage: ezgb_bench <rom> [--frames N] [--runs N]
+//        ezgb_bench --tiles [--runs N]
+//
+// --tiles times the 2bpp tile decoders instead, per tile over a VRAM's worth of tiles
+
+namespace ez {
+namespace {
+
+struct BenchArgs {
+    fs::path m_romPath;
+    bool m_tiles = false;
+    int64_t m_frames = 3600;
+    int m_runs = 3;
+};
+
+struct BenchResult {
+    float m_bestSeconds = std::numeric_limits<float>::max();
+    int64_t m_instructions = 0;
+    std::string m_serialOutput;
+};
+
+void print_usage() {
+    std::cout << "usage: ezgb_bench <rom> [--frames N] [--runs N]\n"
+                 "       ezgb_bench --tiles [--runs N]\n";
+}
+
+std::optional<BenchArgs> parse_args(int argc, char** argv) {
+    auto args = BenchArgs{};
+    for (int i = 1; i < argc; ++i) {
+        const auto arg = std::string_view{argv[i]};
+        if ((arg == "--frames" || arg == "--runs") && i + 1 < argc) {
+            const auto value = std::atoll(argv[++i]);
+            if (value <= 0) {
+                log_error("Expected a positive number for {}", arg);
+                return std::nullopt;
+            }
+            if (arg == "--frames") {
+                args.m_frames = value;
+            } else {
+                args.m_runs = int(value);
+            }
+        } else if (arg == "--tiles") {
+            args.m_tiles = true;
+        } else if (arg.starts_with("--") || !args.m_romPath.empty()) {
+            log_error("Unexpected argument: {}", arg);
+            return std::nullopt;
+        } else {
+            args.m_romPath = fs::path{arg};
+        }
+    }
+    if (args.m_romPath.empty() == !args.m_tiles) {
+        return std::nullopt;
+    }
+    return args;
+}
+
+// what the PPU did before the decoders, a pixel at a time
+void decode_2bpp_rows_per_pixel(const uint8_t* rows, int rowCount, uint8_t* dst) {
+    for (auto y = 0; y < rowCount; ++y) {
+        const auto byte0 = rows[y * 2];
+        const auto byte1 = rows[y * 2 + 1];
+        for (auto x = 0; x < PPU::TILE_DIM_XY; ++x) {
+            const uint8_t bit0 = byte0 & (0b1000'0000 >> x) ? 0b1 : 0;
+            const uint8_t bit1 = byte1 & (0b1000'0000 >> x) ? 0b1 : 0;
+            dst[y * PPU::TILE_DIM_XY + x] = uint8_t(bit1 << 1 | bit0);
+        }
+    }
+}
+
+int run_tile_bench(const BenchArgs& args) {
+    static constexpr auto repeats = 20'000;
+    static constexpr auto rowCount = PPU::TILE_COUNT * PPU::TILE_DIM_XY;
+    auto vram = std::vector<uint8_t>(PPU::TILE_DATA_ADDR_RANGE.width());
+    for (size_t i = 0; i < vram.size(); ++i) {
+        vram[i] = uint8_t(i * 73 + i / 7);
+    }
+    auto reference = std::vector<uint8_t>(size_t(PPU::TILE_COUNT * PPU::PIXELS_PER_TILE));
+    decode_2bpp_rows_per_pixel(vram.data(), rowCount, reference.data());
+
+    struct Decoder {
+        const char* m_name;
+        void (*m_decode)(const uint8_t*, int, uint8_t*);
+    };
+    const auto decoders = std::array<Decoder, 3>{{
+        {"per pixel", &decode_2bpp_rows_per_pixel},
+        {"scalar", &decode_2bpp_rows_scalar},
+        {get_2bpp_decoder_name(), &decode_2bpp_rows},
+    }};
+
+    std::cout << std::format("{} tiles x {}, best of {}\n", PPU::TILE_COUNT, repeats, args.m_runs);
+    auto baselineNs = std::array<double, 2>{};
+    for (const auto& [name, decode] : decoders) {
+        auto pixels = std::vector<uint8_t>(reference.size());
+        // all of VRAM in one call, then a row per call like the PPU does as tile data is written
+        auto bestNs = std::array<double, 2>{std::numeric_limits<double>::max(),
+                                            std::numeric_limits<double>::max()};
+        for (int run = 0; run < args.m_runs; ++run) {
+            for (const auto rowsPerCall : {rowCount, 1}) {
+                auto timer = Stopwatch{};
+                for (int i = 0; i < repeats; ++i) {
+                    for (auto row = 0; row < rowCount; row += rowsPerCall) {
+                        decode(vram.data() + row * 2, rowsPerCall,
+                               pixels.data() + row * PPU::TILE_DIM_XY);
+                    }
+                    // keeps the compiler from dropping all but the last pass
+                    std::atomic_signal_fence(std::memory_order_seq_cst);
+                }
+                const auto seconds = timer.elapsed<fSec>().count();
+                auto& best = bestNs[rowsPerCall == 1];
+                best = std::min(best, seconds * 1e9 / (double(repeats) * PPU::TILE_COUNT));
+            }
+        }
+        if (baselineNs[0] == 0.0) {
+            baselineNs = bestNs;
+        }
+        std::cout << std::format("{:>12}: {:.2f}ns per tile ({:.2f}x), {:.2f}ns a row at a time "
+                                 "({:.2f}x){}\n",
+                                 name, bestNs[0], baselineNs[0] / bestNs[0], bestNs[1],
+                                 baselineNs[1] / bestNs[1],
+                                 pixels == reference ? "" : " (output differs!)");
+    }
+    return 0;
+}
+
+BenchResult run_bench(const BenchArgs& args, const EmuSettings& settings) {
+    auto result = BenchResult{};
+    const auto cycles = args.m_frames * PPU::DOTS_PER_FRAME;
+    for (int run = 0; run < args.m_runs; ++run) {
+        auto cart = Cart::load_from_disk(args.m_romPath);
+        auto emu = Emulator(cart, settings);
+        const auto input = InputState{};
+
+        auto timer = Stopwatch{};
+        emu.set_input(input);
+        emu.run_for(cycles);
+        result.m_bestSeconds = std::min(result.m_bestSeconds, timer.elapsed<fSec>().count());
+        result.m_instructions = emu.get_instruction_counter();
+        result.m_serialOutput = emu.get_serial_output();
+    }
+    return result;
+}
+
+} // namespace
+} // namespace ez
+
+int main(int argc, char** argv) {
+    using namespace ez;
+
+    const auto args = parse_args(argc, argv);
+    if (!args) {
+        print_usage();
+        return 1;
+    }
+    if (args->m_tiles) {
+        return run_tile_bench(*args);
+    }
+    if (!fs::exists(args->m_romPath)) {
+        log_error("ROM not found: {}", args->m_romPath.string());
+        return 1;
+    }
+
+    struct Mode {
+        const char* m_name;
+        CpuDispatch m_dispatch;
+        bool m_debugHooks;
+    };
+    // switch always runs with the hooks
+    const auto modes = std::array<Mode, 6>{{
+        {"switch", CpuDispatch::SWITCH, true},
+        {"table", CpuDispatch::TABLE, false},
+        {"table/debug", CpuDispatch::TABLE, true},
+        {"cached", CpuDispatch::CACHED, false},
+        {"cached/debug", CpuDispatch::CACHED, true},
+        {"jit", CpuDispatch::JIT, false},
+    }};
+
+    std::cout << std::format("rom: {}, {} frames, best of {}\n", args->m_romPath.string(),
+                             args->m_frames, args->m_runs);
+
+    auto baselineSeconds = 0.0f;
+    auto baselineSerial = std::optional<std::string>{};
+    for (const auto& [name, dispatch, debugHooks] : modes) {
+        auto settings = EmuSettings{};
+        settings.m_cpuDispatch = dispatch;
+        settings.m_debugHooks = debugHooks;
+        const auto result = run_bench(*args, settings);
+        if (!baselineSerial) {
+            baselineSerial = result.m_serialOutput;
+            baselineSeconds = result.m_bestSeconds;
+        }
+        const auto diverged = result.m_serialOutput != *baselineSerial;
+        std::cout << std::format("{:>12}: {:.3f}s, {:.1f}M instructions/s, {:.2f}x{}\n", name,
+                                 result.m_bestSeconds,
+                                 result.m_instructions / result.m_bestSeconds / 1e6,
+                                 baselineSeconds / result.m_bestSeconds,
+                                 diverged ? " (serial output differs!)" : "");
+    }
+
+    return 0;
+}
@@ -0,0 +1,251 @@
+#include "Base.h"
+#include "Cart.h"
+#include "Emulator.h"
+#include <algorithm>
+#include <sstream>
+
+#ifdef EZ_RECOMPILED_ROM
+// written by ezgb_recompile, see Recompiler.h
+extern const ez::CompiledRom RECOMPILED_ROM;
+#endif
+
+// Headless runner - no window, audio or GUI, runs the emulator as fast as the host allows.
+//
+// usage: ezgb_headless <rom> [--frames N | --cycles N] [--input FILE] [--skip-bootrom] [--log]
+//                      [--no-idle-skip] [--jit] [--trace FILE] [--profile FILE]
+//
+// The input file is plain text, one entry per line: a frame number followed by the buttons held
+// from that frame on, e.g. "120 start" or "300 a right". A line with only a frame number releases
+// everything. Lines starting with # are ignored.
+//
+// --trace records every instruction to a binary trace, which ezgb_trace prints and diffs.
+//
+// --profile counts cycles per instruction address and opcode and writes the hottest ones at the
+// end of the run, as JSON if FILE ends in .json and CSV otherwise.
+//
+// Idle loops aren't skipped while either records, so both see every instruction.
+//
+// --jit runs hot blocks as native code (CpuDispatch::JIT), on hosts without a backend it's the
+// same as leaving it out. The results have to match a run without it.
+
+namespace ez {
+namespace {
+
+constexpr size_t PROFILE_HOT_SPOTS = 256;
+
+struct InputEvent {
+    int64_t m_frame = 0;
+    InputState m_state{};
+};
+
+struct HeadlessArgs {
+    fs::path m_romPath;
+    std::optional<fs::path> m_inputPath;
+    std::optional<fs::path> m_tracePath;
+    std::optional<fs::path> m_profilePath;
+    int64_t m_cycleBudget = 60 * 60 * int64_t(PPU::DOTS_PER_FRAME); // one emulated minute
+    EmuSettings m_settings{};
+};
+
+void print_usage() {
+    std::cout << "usage: ezgb_headless <rom> [--frames N | --cycles N] [--input FILE] "
+                 "[--skip-bootrom] [--log] [--no-idle-skip] [--jit] [--trace FILE] "
+                 "[--profile FILE]\n";
+}
+
+std::optional<HeadlessArgs> parse_args(int argc, char** argv) {
+    auto args = HeadlessArgs{};
+    const auto nextValue = [&](int& i) -> std::optional<std::string_view> {
+        if (i + 1 >= argc) {
+            log_error("Missing value for {}", argv[i]);
+            return std::nullopt;
+        }
+        return std::string_view{argv[++i]};
+    };
+    const auto toInt = [](std::string_view str) -> std::optional<int64_t> {
+        try {
+            return std::stoll(std::string(str));
+        } catch (const std::exception&) {
+            log_error("Expected a number, got {}", str);
+            return std::nullopt;
+        }
+    };
+
+    for (int i = 1; i < argc; ++i) {
+        const auto arg = std::string_view{argv[i]};
+        if (arg == "--frames" || arg == "--cycles") {
+            const auto value = nextValue(i);
+            const auto count = value ? toInt(*value) : std::nullopt;
+            if (!count || *count <= 0) {
+                return std::nullopt;
+            }
+            args.m_cycleBudget = arg == "--frames" ? *count * PPU::DOTS_PER_FRAME : *count;
+        } else if (arg == "--input") {
+            const auto value = nextValue(i);
+            if (!value) {
+                return std::nullopt;
+            }
+            args.m_inputPath = fs::path{*value};
+        } else if (arg == "--trace") {
+            const auto value = nextValue(i);
+            if (!value) {
+                return std::nullopt;
+            }
+            args.m_tracePath = fs::path{*value};
+        } else if (arg == "--profile") {
+            const auto value = nextValue(i);
+            if (!value) {
+                return std::nullopt;
+            }
+            args.m_profilePath = fs::path{*value};
+        } else if (arg == "--skip-bootrom") {
+            args.m_settings.m_skipBootROM = true;
+        } else if (arg == "--log") {
+            args.m_settings.m_logEnable = true;
+        } else if (arg == "--no-idle-skip") {
+            args.m_settings.m_skipIdleLoops = false;
+        } else if (arg == "--jit") {
+            args.m_settings.m_cpuDispatch = CpuDispatch::JIT;
+        } else if (arg.starts_with("--") || !args.m_romPath.empty()) {
+            log_error("Unexpected argument: {}", arg);
+            return std::nullopt;
+        } else {
+            args.m_romPath = fs::path{arg};
+        }
+    }
+
+    if (args.m_romPath.empty()) {
+        return std::nullopt;
+    }
+    return args;
+}
+
+std::optional<std::vector<InputEvent>> load_input_events(const fs::path& path) {
+    auto file = std::ifstream(path);
+    if (!file) {
+        log_error("Failed to open input file: {}", path.string());
+        return std::nullopt;
+    }
+
+    auto events = std::vector<InputEvent>{};
+    auto line = std::string{};
+    for (int lineNo = 1; std::getline(file, line); ++lineNo) {
+        auto stream = std::istringstream(line);
+        auto event = InputEvent{};
+        if (line.starts_with('#') || !(stream >> event.m_frame)) {
+            continue;
+        }
+        auto button = std::string{};
+        while (stream >> button) {
+            std::ranges::transform(button, button.begin(), [](char c) { return char(tolower(c)); });
+            if (button == "a") {
+                event.m_state.m_a = true;
+            } else if (button == "b") {
+                event.m_state.m_b = true;
+            } else if (button == "start") {
+                event.m_state.m_start = true;
+            } else if (button == "select") {
+                event.m_state.m_select = true;
+            } else if (button == "left") {
+                event.m_state.m_left = true;
+            } else if (button == "right") {
+                event.m_state.m_right = true;
+            } else if (button == "up") {
+                event.m_state.m_up = true;
+            } else if (button == "down") {
+                event.m_state.m_down = true;
+            } else {
+                log_error("{}:{} unknown button: {}", path.string(), lineNo, button);
+                return std::nullopt;
+            }
+        }
+        events.push_back(event);
+    }
+
+    std::ranges::stable_sort(events, {}, &InputEvent::m_frame);
+    return events;
+}
+
+} // namespace
+} // namespace ez
+
+int main(int argc, char** argv) {
+    using namespace ez;
+
+    const auto args = parse_args(argc, argv);
+    if (!args) {
+        print_usage();
+        return 1;
+    }
+
+    auto inputEvents = std::vector<InputEvent>{};
+    if (args->m_inputPath) {
+        auto loaded = load_input_events(*args->m_inputPath);
+        if (!loaded) {
+            return 1;
+        }
+        inputEvents = std::move(*loaded);
+    }
+
+    if (!fs::exists(args->m_romPath)) {
+        log_error("ROM not found: {}", args->m_romPath.string());
+        return 1;
+    }
+    auto cart = Cart::load_from_disk(args->m_romPath);
+    auto settings = args->m_settings;
+    settings.m_displayFormat = DisplayFormat::INDEXED; // nothing here looks at the frames
+#ifdef EZ_RECOMPILED_ROM
+    settings.m_compiledRom = &RECOMPILED_ROM;
+#endif
+    auto emu = Emulator(cart, settings);
+    if (args->m_tracePath && !emu.start_trace(*args->m_tracePath)) {
+        return 1;
+    }
+    if (args->m_profilePath) {
+        emu.start_profiling();
+    }
+
+    auto input = InputState{};
+    auto nextEvent = inputEvents.begin();
+
+    auto timer = Stopwatch{};
+    for (int64_t cycle = 0; cycle < args->m_cycleBudget; cycle += PPU::DOTS_PER_FRAME) {
+        const auto frame = cycle / PPU::DOTS_PER_FRAME;
+        for (; nextEvent != inputEvents.end() && nextEvent->m_frame <= frame; ++nextEvent) {
+            input = nextEvent->m_state;
+        }
+        emu.set_input(input);
+        emu.run_for(std::min<int64_t>(PPU::DOTS_PER_FRAME, args->m_cycleBudget - cycle));
+    }
+    const auto wallSeconds = std::max(timer.elapsed<fSec>().count(), 1e-6f);
+    emu.stop_trace();
+    emu.stop_profiling();
+
+    const auto frames = double(args->m_cycleBudget) / PPU::DOTS_PER_FRAME;
+    const auto emulatedSeconds =
+        chrono::duration<double>(args->m_cycleBudget * MASTER_CLOCK_PERIOD).count();
+    const auto instructions = emu.get_instruction_counter();
+
+    if (!emu.get_serial_output().empty()) {
+        std::cout << std::format("serial: {}\n", emu.get_serial_output());
+    }
+    std::cout << std::format("rom: {}\n", args->m_romPath.string());
+    std::cout << std::format("emulated: {:.1f} frames, {} T-cycles, {} instructions\n", frames,
+                             args->m_cycleBudget, instructions);
+    std::cout << std::format("wall time: {:.3f}s ({:.2f}x real time)\n", wallSeconds,
+                             emulatedSeconds / wallSeconds);
+    std::cout << std::format("emulated fps: {:.1f}\n", frames / wallSeconds);
+    std::cout << std::format("instructions per second: {:.0f}\n", instructions / wallSeconds);
+    std::cout << std::format("idle loops: {} skips, {} T-cycles skipped ({:.1f}%)\n",
+                             emu.get_idle_loop_hits(), emu.get_idle_loop_skipped_cycles(),
+                             100.0 * emu.get_idle_loop_skipped_cycles() / args->m_cycleBudget);
+
+    if (args->m_profilePath) {
+        if (!emu.get_profiler()->write_report(*args->m_profilePath, PROFILE_HOT_SPOTS)) {
+            return 1;
+        }
+        std::cout << std::format("profile: {}\n", args->m_profilePath->string());
+    }
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include "Base.h"
+#include "Cart.h"
+#include "Recompiler.h"
+
+// Static recompiler - disassembles every bank of a ROM and writes a C++ file with one function per
+// recovered block, see Recompiler.h. Configure with -DEZ_RECOMPILED_ROM=<out.cpp> (and ideally
+// -DEZ_LTO=ON) to build it into ezgb_recompiled, a headless runner for that ROM only
+//
+// usage: ezgb_recompile <rom> <out.cpp>
+
+int main(int argc, char** argv) {
+    using namespace ez;
+
+    if (argc != 3) {
+        std::cout << "usage: ezgb_recompile <rom> <out.cpp>\n";
+        return 1;
+    }
+    const auto romPath = fs::path{argv[1]};
+    const auto outPath = fs::path{argv[2]};
+    if (!fs::exists(romPath)) {
+        log_error("ROM not found: {}", romPath.string());
+        return 1;
+    }
+
+    const auto cart = Cart::load_from_disk(romPath);
+    const auto rom = cart.get_rom();
+    const auto blocks = recover_blocks(rom);
+
+    auto file = std::ofstream(outPath, std::ios::binary);
+    if (!file) {
+        log_error("Failed to open output file: {}", outPath.string());
+        return 1;
+    }
+    file << emit_compiled_rom(rom, blocks, romPath.filename().string());
+
+    auto instructions = size_t(0);
+    for (const auto& block : blocks) {
+        instructions += block.m_instrs.size();
+    }
+    std::cout << std::format("{}: {} blocks, {} instructions -> {}\n", romPath.string(),
+                             blocks.size(), instructions, outPath.string());
+    return 0;
+}
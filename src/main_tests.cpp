@@ -0,0 +1,7 @@
+#include "Base.h"
+#include "Test.h"
+
+int main(int, char**) {
+    auto t = ez::Tester{};
+    return t.test_all() ? 0 : 1;
+}
@@ -0,0 +1,98 @@
+#include "Base.h"
+#include "Trace.h"
+
+// Reads the binary traces ezgb_headless --trace writes, see Trace.h
+//
+// usage: ezgb_trace dump <trace> [first] [count]   prints records as text, 100 from 0 by default
+//        ezgb_trace diff <a> <b> [context]         finds the first record the traces disagree on
+//                                                  and prints it with the records leading up to it
+
+namespace ez {
+namespace {
+
+constexpr int64_t DEFAULT_DUMP_COUNT = 100;
+constexpr int64_t DEFAULT_DIFF_CONTEXT = 8;
+
+void print_usage() {
+    std::cout << "usage: ezgb_trace dump <trace> [first] [count]\n"
+                 "       ezgb_trace diff <a> <b> [context]\n";
+}
+
+std::optional<int64_t> parse_count(const char* str) {
+    try {
+        return std::stoll(str);
+    } catch (const std::exception&) {
+        log_error("Expected a number, got {}", str);
+        return std::nullopt;
+    }
+}
+
+int dump(TraceReader& trace, int64_t first, int64_t count) {
+    const auto last = std::min(trace.size(), first + count);
+    for (auto index = first; index < last; ++index) {
+        const auto record = trace.get(index);
+        if (!record) {
+            return 1;
+        }
+        std::cout << std::format("{:>10} {}\n", index, to_string(*record));
+    }
+    return 0;
+}
+
+int diff(TraceReader& a, TraceReader& b, int64_t context) {
+    const auto common = std::min(a.size(), b.size());
+    for (int64_t index = 0; index < common; ++index) {
+        const auto recordA = a.get(index);
+        const auto recordB = b.get(index);
+        if (!recordA || !recordB) {
+            return 1;
+        }
+        if (*recordA == *recordB) {
+            continue;
+        }
+        std::cout << std::format("traces diverge at record {}\n", index);
+        const auto first = std::max<int64_t>(0, index - context);
+        for (auto i = first; i < index; ++i) {
+            std::cout << std::format("  {:>10} {}\n", i, to_string(*a.get(i)));
+        }
+        std::cout << std::format("a {:>10} {}\n", index, to_string(*recordA));
+        std::cout << std::format("b {:>10} {}\n", index, to_string(*recordB));
+        return 2;
+    }
+    if (a.size() != b.size()) {
+        std::cout << std::format("traces match for {} records, then one ends ({} vs {})\n",
+                                 common, a.size(), b.size());
+        return 2;
+    }
+    std::cout << std::format("traces match, {} records\n", common);
+    return 0;
+}
+
+} // namespace
+} // namespace ez
+
+int main(int argc, char** argv) {
+    using namespace ez;
+
+    const auto command = argc >= 3 ? std::string_view{argv[1]} : std::string_view{};
+    if (command == "dump" && argc <= 5) {
+        auto trace = TraceReader(argv[2]);
+        const auto first = argc > 3 ? parse_count(argv[3]) : 0;
+        const auto count = argc > 4 ? parse_count(argv[4]) : DEFAULT_DUMP_COUNT;
+        if (!trace.is_open() || !first || !count) {
+            return 1;
+        }
+        return dump(trace, *first, *count);
+    }
+    if (command == "diff" && argc >= 4 && argc <= 5) {
+        auto a = TraceReader(argv[2]);
+        auto b = TraceReader(argv[3]);
+        const auto context = argc > 4 ? parse_count(argv[4]) : DEFAULT_DIFF_CONTEXT;
+        if (!a.is_open() || !b.is_open() || !context) {
+            return 1;
+        }
+        return diff(a, b, *context);
+    }
+    print_usage();
+    return 1;
+}